@@ -0,0 +1,35 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\component_type.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <mutex>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	[[nodiscard]]
+	ComponentTypeId GetComponentTypeId(std::type_index type) {
+		static std::mutex mutex;
+		static std::unordered_map< std::type_index, ComponentTypeId > ids;
+
+		const std::scoped_lock lock(mutex);
+
+		const auto id = static_cast< ComponentTypeId >(ids.size());
+		return ids.try_emplace(type, id).first->second;
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <typeindex>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The type of component type ids.
+	 */
+	using ComponentTypeId = U32;
+
+	/**
+	 Returns the component type id of the given type.
+
+	 Component type ids are dense and assigned on first use of each type.
+
+	 @param[in]		type
+					The type.
+	 @return		The component type id of the given type.
+	 @throws		std::bad_alloc
+					Failed to register the given type.
+	 */
+	[[nodiscard]]
+	ComponentTypeId GetComponentTypeId(std::type_index type);
+
+	/**
+	 Returns the component type id of the given type.
+
+	 @tparam		ComponentT
+					The component type.
+	 @return		The component type id of the given type.
+	 @throws		std::bad_alloc
+					Failed to register the given type.
+	 */
+	template< typename ComponentT >
+	[[nodiscard]]
+	inline ComponentTypeId GetComponentTypeId() {
+		static const auto id = GetComponentTypeId(typeid(ComponentT));
+		return id;
+	}
+}
@@ -0,0 +1,318 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\state.hpp"
+#include "type\atomic_types.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of element vectors.
+
+	 An element vector stores its elements contiguously and refers to them
+	 via stable slots. Proxy pointers to elements of an element vector store
+	 the slot of the element, so they remain valid when the element vector
+	 moves its elements. Terminated elements are reused in constant amortized
+	 time, and can be removed with @c compact to keep the elements dense.
+
+	 @tparam		ElementT
+					The element type.
+	 */
+	template< typename ElementT >
+	class ElementVector {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		using value_type = ElementT;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+
+		using iterator = typename AlignedVector< ElementT >::iterator;
+		using const_iterator = typename AlignedVector< ElementT >::const_iterator;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		ElementVector() noexcept
+			: m_elements(),
+			m_slots(),
+			m_indices(),
+			m_terminated(),
+			m_free_slot(s_no_slot),
+			m_nb_inserts(0u),
+			m_version(0u) {}
+
+		ElementVector(const ElementVector& elements) = delete;
+
+		ElementVector(ElementVector&& elements) noexcept = default;
+
+		~ElementVector() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		ElementVector& operator=(const ElementVector& elements) = delete;
+
+		ElementVector& operator=(ElementVector&& elements) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Element Access
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		reference operator[](size_type index) noexcept {
+			return m_elements[index];
+		}
+
+		[[nodiscard]]
+		const_reference operator[](size_type index) const noexcept {
+			return m_elements[index];
+		}
+
+		[[nodiscard]]
+		ElementT* data() noexcept {
+			return m_elements.data();
+		}
+
+		[[nodiscard]]
+		const ElementT* data() const noexcept {
+			return m_elements.data();
+		}
+
+		/**
+		 Returns the element of this element vector with the given slot.
+
+		 @param[in]		slot
+						The slot of the element.
+		 @return		A pointer to the element of this element vector with
+						the given slot. @c nullptr if no element has that
+						slot.
+		 */
+		[[nodiscard]]
+		ElementT* find(size_type slot) noexcept {
+			return const_cast< ElementT* >(std::as_const(*this).find(slot));
+		}
+
+		/**
+		 Returns the element of this element vector with the given slot.
+
+		 @param[in]		slot
+						The slot of the element.
+		 @return		A pointer to the element of this element vector with
+						the given slot. @c nullptr if no element has that
+						slot.
+		 */
+		[[nodiscard]]
+		const ElementT* find(size_type slot) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Iterators
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		iterator begin() noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator begin() const noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator cbegin() const noexcept {
+			return m_elements.cbegin();
+		}
+
+		[[nodiscard]]
+		iterator end() noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator end() const noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator cend() const noexcept {
+			return m_elements.cend();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Capacity
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_elements.empty();
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept {
+			return m_elements.size();
+		}
+
+		/**
+		 Returns the version of this element vector. The version changes
+		 whenever this element vector moves, destroys or replaces its elements
+		 (i.e. whenever pointers to its elements may become invalid or may
+		 refer to other elements). Versions are unique across all element
+		 vectors.
+
+		 @return		The version of this element vector.
+		 */
+		[[nodiscard]]
+		U64 version() const noexcept {
+			return m_version;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Modifiers
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an element in this element vector. The element replaces a
+		 terminated element if available.
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the element.
+		 @param[in]		args
+						A reference to the constructor arguments for the
+						element.
+		 @return		The slot of the element.
+		 */
+		template< typename... ConstructorArgsT >
+		size_type emplace(ConstructorArgsT&&... args);
+
+		/**
+		 Removes the terminated elements of this element vector while
+		 preserving the order of the remaining elements. The slots of the
+		 remaining elements do not change.
+		 */
+		void compact();
+
+		void clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The slot indicating the end of the free slot list.
+		 */
+		static constexpr U32 s_no_slot = U32(-1);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Collects the indices of the terminated elements of this element
+		 vector.
+		 */
+		void Collect();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the elements of this element vector.
+		 */
+		AlignedVector< ElementT > m_elements;
+
+		/**
+		 A vector containing the slot of each element of this element
+		 vector.
+		 */
+		std::vector< U32 > m_slots;
+
+		/**
+		 A vector containing the element index of each used slot of this
+		 element vector. Each free slot contains the next free slot instead.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector containing the collected indices of terminated elements of
+		 this element vector.
+		 */
+		std::vector< U32 > m_terminated;
+
+		/**
+		 The first free slot of this element vector.
+		 */
+		U32 m_free_slot;
+
+		/**
+		 The number of constructed elements of this element vector since the
+		 last collection.
+		 */
+		size_type m_nb_inserts;
+
+		/**
+		 The version of this element vector.
+		 */
+		U64 m_version;
+	};
+
+	/**
+	 Returns the memory resource stored at the given slot of the given element
+	 vector.
+
+	 @tparam		ElementT
+					The element type.
+	 @param[in]		elements
+					A reference to the element vector.
+	 @param[in]		slot
+					The slot of the element.
+	 @return		A pointer to the memory resource stored at the given slot
+					of the given element vector. @c nullptr if no element has
+					that slot.
+	 */
+	template< typename ElementT >
+	[[nodiscard]]
+	auto* GetProxyElementAt(ElementVector< ElementT >& elements,
+							std::size_t slot) noexcept;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\element_vector.tpp"
+
+#pragma endregion
@@ -0,0 +1,166 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		template< typename ElementT >
+		[[nodiscard]]
+		inline bool IsTerminated(const ElementT& element) noexcept {
+			return State::Terminated == element.GetState();
+		}
+
+		template< typename ElementT, typename DeleterT >
+		[[nodiscard]]
+		inline bool IsTerminated(
+			const std::unique_ptr< ElementT, DeleterT >& element) noexcept {
+
+			return !element || State::Terminated == element->GetState();
+		}
+
+		/**
+		 Returns a new version for element vectors. Versions are unique
+		 across all element vectors and increase monotonically.
+
+		 @return		A new version for element vectors.
+		 */
+		[[nodiscard]]
+		inline U64 NextVersion() noexcept {
+			static AtomicU64 s_version(0u);
+			return s_version.fetch_add(1u, std::memory_order_relaxed) + 1u;
+		}
+	}
+
+	template< typename ElementT >
+	[[nodiscard]]
+	const ElementT* ElementVector< ElementT >::find(size_type slot) const noexcept {
+		if (m_indices.size() <= slot) {
+			return nullptr;
+		}
+
+		// Free slots contain the next free slot instead of an element index.
+		const auto index = m_indices[slot];
+		if (m_elements.size() <= index || slot != m_slots[index]) {
+			return nullptr;
+		}
+
+		return &m_elements[index];
+	}
+
+	template< typename ElementT >
+	template< typename... ConstructorArgsT >
+	typename ElementVector< ElementT >::size_type
+		ElementVector< ElementT >::emplace(ConstructorArgsT&&... args) {
+
+		// Collecting costs linear time and only happens once the number of
+		// elements constructed since the previous collection is at least half
+		// the number of elements, which amortizes the cost over these
+		// constructions.
+		if (m_terminated.empty() && m_elements.size() <= 2u * m_nb_inserts) {
+			Collect();
+		}
+
+		++m_nb_inserts;
+
+		while (!m_terminated.empty()) {
+			const auto index = m_terminated.back();
+			m_terminated.pop_back();
+
+			auto& element = m_elements[index];
+			if (details::IsTerminated(element)) {
+				// The terminated element is replaced in place.
+				m_version = details::NextVersion();
+				element = ElementT(std::forward< ConstructorArgsT >(args)...);
+				return m_slots[index];
+			}
+		}
+
+		const auto index = static_cast< U32 >(m_elements.size());
+		if (m_elements.size() == m_elements.capacity()) {
+			// The elements are moved to new storage.
+			m_version = details::NextVersion();
+		}
+		m_elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
+
+		auto slot = m_free_slot;
+		if (s_no_slot != slot) {
+			m_free_slot     = m_indices[slot];
+			m_indices[slot] = index;
+		}
+		else {
+			slot = static_cast< U32 >(m_indices.size());
+			m_indices.push_back(index);
+		}
+
+		m_slots.push_back(slot);
+		return slot;
+	}
+
+	template< typename ElementT >
+	void ElementVector< ElementT >::compact() {
+		size_type nb_elements = 0u;
+		for (size_type i = 0u; i < m_elements.size(); ++i) {
+			const auto slot = m_slots[i];
+
+			if (details::IsTerminated(m_elements[i])) {
+				m_indices[slot] = m_free_slot;
+				m_free_slot     = slot;
+				continue;
+			}
+
+			if (nb_elements != i) {
+				m_elements[nb_elements] = std::move(m_elements[i]);
+				m_slots[nb_elements]    = slot;
+				m_indices[slot]         = static_cast< U32 >(nb_elements);
+			}
+
+			++nb_elements;
+		}
+
+		if (nb_elements != m_elements.size()) {
+			m_version = details::NextVersion();
+		}
+
+		m_elements.erase(m_elements.begin() + nb_elements, m_elements.end());
+		m_slots.resize(nb_elements);
+		m_terminated.clear();
+		m_nb_inserts = 0u;
+	}
+
+	template< typename ElementT >
+	void ElementVector< ElementT >::clear() noexcept {
+		m_elements.clear();
+		m_slots.clear();
+		m_indices.clear();
+		m_terminated.clear();
+		m_free_slot  = s_no_slot;
+		m_nb_inserts = 0u;
+		m_version = details::NextVersion();
+	}
+
+	template< typename ElementT >
+	void ElementVector< ElementT >::Collect() {
+		m_terminated.clear();
+
+		// Reuse the terminated elements with the lowest indices first.
+		for (auto i = m_elements.size(); 0u < i--; ) {
+			if (details::IsTerminated(m_elements[i])) {
+				m_terminated.push_back(static_cast< U32 >(i));
+			}
+		}
+
+		m_nb_inserts = 0u;
+	}
+
+	template< typename ElementT >
+	[[nodiscard]]
+	inline auto* GetProxyElementAt(ElementVector< ElementT >& elements,
+								   std::size_t slot) noexcept {
+
+		auto* const element = elements.find(slot);
+		return element ? details::GetProxyElement(*element) : nullptr;
+	}
+}
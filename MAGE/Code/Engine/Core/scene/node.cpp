@@ -13,10 +13,31 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 The version of the node hierarchies.
+		 */
+		AtomicU64 g_hierarchy_version = 0u;
+
+		/**
+		 Invalidates the version of the node hierarchies.
+		 */
+		void InvalidateHierarchyVersion() noexcept {
+			g_hierarchy_version.fetch_add(1u, std::memory_order_relaxed);
+		}
+	}
+
+	[[nodiscard]]
+	U64 Node::GetHierarchyVersion() noexcept {
+		return g_hierarchy_version.load(std::memory_order_relaxed);
+	}
+
 	Node::Node(std::string name)
 		: m_transform(),
 		m_parent(nullptr),
 		m_childs(),
+		m_component_types(),
 		m_components(),
 		m_state(State::Active),
 		m_guid(GetNextGuid()),
@@ -27,6 +48,7 @@ namespace mage {
 		: m_transform(node.m_transform),
 		m_parent(nullptr),
 		m_childs(),
+		m_component_types(),
 		m_components(),
 		m_state(node.m_state),
 		m_guid(GetNextGuid()),
@@ -37,6 +59,7 @@ namespace mage {
 		: m_transform(std::move(node.m_transform)),
 		m_parent(std::move(node.m_parent)),
 		m_childs(std::move(node.m_childs)),
+		m_component_types(std::move(node.m_component_types)),
 		m_components(std::move(node.m_components)),
 		m_state(node.m_state),
 		m_guid(node.m_guid),
@@ -49,6 +72,7 @@ namespace mage {
 
 	void Node::Set(NodePtr ptr) noexcept {
 		m_this = std::move(ptr);
+		InvalidateHierarchyVersion();
 
 		TransformClient::SetOwner(m_transform, m_this);
 
@@ -82,6 +106,7 @@ namespace mage {
 		node->m_transform.SetDirty();
 
 		m_childs.push_back(std::move(node));
+		InvalidateHierarchyVersion();
 	}
 
 	void Node::RemoveChild(NodePtr node) {
@@ -100,6 +125,7 @@ namespace mage {
 			it != cend(m_childs)) {
 
 			m_childs.erase(it);
+			InvalidateHierarchyVersion();
 		}
 		else {
 			Fatal("Node connections are broken.");
@@ -113,6 +139,7 @@ namespace mage {
 		});
 
 		m_childs.clear();
+		InvalidateHierarchyVersion();
 	}
 
 	//-------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "scene\component.hpp"
+#include "scene\component_type.hpp"
 #include "scene\transform.hpp"
 
 #pragma endregion
@@ -15,8 +16,6 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <typeindex>
-#include <unordered_map>
 #include <vector>
 
 #pragma endregion
@@ -47,6 +46,21 @@ namespace mage {
 		 */
 		using ComponentPtr = ProxyPtr< Component >;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the version of the node hierarchies.
+
+		 The version changes whenever a node is (re)bound or a parent-child
+		 relation between nodes is added or removed.
+
+		 @return		The version of the node hierarchies.
+		 */
+		[[nodiscard]]
+		static U64 GetHierarchyVersion() noexcept;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -249,10 +263,12 @@ namespace mage {
 						The component type.
 		 @return		@c true if this node contains at least one component
 						of the given type. @c false otherwise.
+		 @throws		std::bad_alloc
+						Failed to register the given component type.
 		 */
 		template< typename ComponentT >
 		[[nodiscard]]
-		bool Contains() const noexcept;
+		bool Contains() const;
 
 		/**
 		 Checks whether this node contains components.
@@ -284,10 +300,12 @@ namespace mage {
 						The component type.
 		 @return		The number of components of the given type of this
 						node.
+		 @throws		std::bad_alloc
+						Failed to register the given component type.
 		 */
 		template< typename ComponentT >
 		[[nodiscard]]
-		std::size_t GetNumberOf() const noexcept;
+		std::size_t GetNumberOf() const;
 
 		/**
 		 Returns the first component of the given type of this node.
@@ -298,10 +316,12 @@ namespace mage {
 						type.
 		 @return		A pointer to the first component of the given type of
 						this node.
+		 @throws		std::bad_alloc
+						Failed to register the given component type.
 		 */
 		template< typename ComponentT >
 		[[nodiscard]]
-		ProxyPtr< ComponentT > Get() noexcept;
+		ProxyPtr< ComponentT > Get();
 
 		/**
 		 Returns the first component of the given type of this node.
@@ -312,10 +332,12 @@ namespace mage {
 						type.
 		 @return		A pointer to the first component of the given type of
 						this node.
+		 @throws		std::bad_alloc
+						Failed to register the given component type.
 		 */
 		template< typename ComponentT >
 		[[nodiscard]]
-		ProxyPtr< const ComponentT > Get() const noexcept;
+		ProxyPtr< const ComponentT > Get() const;
 
 		/**
 		 Returns all components of the given type of this node.
@@ -522,10 +544,14 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 A multimap containing pointers to the components of this node as
-		 values with their associated type as key.
+		 A vector containing the type ids of the components of this node.
+		 */
+		std::vector< ComponentTypeId > m_component_types;
+
+		/**
+		 A vector containing pointers to the components of this node.
 		 */
-		std::unordered_multimap< std::type_index, ComponentPtr > m_components;
+		std::vector< ComponentPtr > m_components;
 
 		//---------------------------------------------------------------------
 		// Member Variables: State
@@ -1,5 +1,14 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -37,30 +46,51 @@ namespace mage {
 
 	template< typename ComponentT >
 	[[nodiscard]]
-	inline bool Node::Contains() const noexcept {
-		return m_components.find(typeid(ComponentT)) != m_components.cend();
+	inline bool Node::Contains() const {
+		using std::cbegin;
+		using std::cend;
+
+		const auto type = GetComponentTypeId< ComponentT >();
+		return std::find(cbegin(m_component_types), cend(m_component_types),
+						 type) != cend(m_component_types);
 	}
 
 	template< typename ComponentT >
 	[[nodiscard]]
-	inline std::size_t Node::GetNumberOf() const noexcept {
-		return m_components.count(typeid(ComponentT));
+	inline std::size_t Node::GetNumberOf() const {
+		using std::cbegin;
+		using std::cend;
+
+		const auto type = GetComponentTypeId< ComponentT >();
+		return static_cast< std::size_t >(
+			std::count(cbegin(m_component_types), cend(m_component_types),
+					   type));
 	}
 
 	template< typename ComponentT >
 	[[nodiscard]]
-	inline ProxyPtr< ComponentT > Node::Get() noexcept {
-		const auto it = m_components.find(typeid(ComponentT));
-		return (it != m_components.end()) ?
-			static_pointer_cast< ComponentT >(it->second) : nullptr;
+	inline ProxyPtr< ComponentT > Node::Get() {
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				return static_pointer_cast< ComponentT >(m_components[i]);
+			}
+		}
+
+		return nullptr;
 	}
 
 	template< typename ComponentT >
 	[[nodiscard]]
-	inline ProxyPtr< const ComponentT > Node::Get() const noexcept {
-		const auto it = m_components.find(typeid(ComponentT));
-		return (it != m_components.cend()) ?
-			static_pointer_cast< const ComponentT >(it->second) : nullptr;
+	inline ProxyPtr< const ComponentT > Node::Get() const {
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				return static_pointer_cast< const ComponentT >(m_components[i]);
+			}
+		}
+
+		return nullptr;
 	}
 
 	template< typename ComponentT >
@@ -68,12 +98,12 @@ namespace mage {
 	const std::vector< ProxyPtr< ComponentT > > Node::GetAll() {
 		std::vector< ProxyPtr< ComponentT > > components;
 
-		const auto range = m_components.equal_range(typeid(ComponentT));
-		for_each(range.first, range.second,
-			[&components](auto& x) {
-				components.push_back(static_pointer_cast< ComponentT >(x.second));
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				components.push_back(static_pointer_cast< ComponentT >(m_components[i]));
 			}
-		);
+		}
 
 		return components;
 	}
@@ -83,12 +113,12 @@ namespace mage {
 	const std::vector< ProxyPtr< const ComponentT > > Node::GetAll() const {
 		std::vector< ProxyPtr< const ComponentT > > components;
 
-		const auto range = m_components.equal_range(typeid(ComponentT));
-		for_each(range.first, range.second,
-			[&components](auto& x) {
-				components.push_back(static_pointer_cast< const ComponentT >(x.second));
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				components.push_back(static_pointer_cast< const ComponentT >(m_components[i]));
 			}
-		);
+		}
 
 		return components;
 	}
@@ -104,42 +134,42 @@ namespace mage {
 
 		ComponentClient::SetOwner(*component, m_this);
 
-		m_components.emplace(typeid(*component), std::move(component));
+		// Components are keyed by their dynamic type.
+		m_component_types.push_back(GetComponentTypeId(typeid(*component)));
+		m_components.push_back(std::move(component));
 	}
 
 	template< typename ComponentT, typename ActionT >
 	void Node::ForEach(ActionT&& action) {
-		const auto range = m_components.equal_range(typeid(ComponentT));
-		for_each(range.first, range.second,
-			[&action](auto& x) {
-				action(static_cast< ComponentT& >(*x.second));
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				action(static_cast< ComponentT& >(*m_components[i]));
 			}
-		);
+		}
 	}
 
 	template< typename ComponentT, typename ActionT >
 	void Node::ForEach(ActionT&& action) const {
-		const auto range = m_components.equal_range(typeid(ComponentT));
-		for_each(range.first, range.second,
-			[&action](auto& x) {
-				action(static_cast< const ComponentT& >(*x.second));
+		const auto type = GetComponentTypeId< ComponentT >();
+		for (std::size_t i = 0u; i < m_component_types.size(); ++i) {
+			if (type == m_component_types[i]) {
+				action(static_cast< const ComponentT& >(*m_components[i]));
 			}
-		);
+		}
 	}
 
 	template< typename ActionT >
 	void Node::ForEachComponent(ActionT&& action) {
-		for (const auto& [key, value] : m_components) {
-			(void)key; // Unused
-			action(*value);
+		for (const auto& component : m_components) {
+			action(*component);
 		}
 	}
 
 	template< typename ActionT >
 	void Node::ForEachComponent(ActionT&& action) const {
-		for (const auto& [key, value] : m_components) {
-			(void)key; // Unused
-			action(static_cast< const Component& >(*value));
+		for (const auto& component : m_components) {
+			action(static_cast< const Component& >(*component));
 		}
 	}
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\vector.hpp"
+#include "scene\element_vector.hpp"
 
 #pragma endregion
 
@@ -15,11 +15,11 @@
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(ElementVector< ElementT >& elements,
 									ConstructorArgsT&&... args);
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(ElementVector< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args);
 }
 
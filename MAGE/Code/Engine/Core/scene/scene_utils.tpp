@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\state.hpp"
+#include "scene\element_vector.hpp"
 
 #pragma endregion
 
@@ -15,42 +15,18 @@
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(ElementVector< ElementT >& elements,
 									ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element.GetState()) {
-				element = ElementT(std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >(elements, index);
-			}
-
-			++index;
-		}
-
-		elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
-		return ProxyPtr< ElementT >(elements, index);
+		const auto slot
+			= elements.emplace(std::forward< ConstructorArgsT >(args)...);
+		return ProxyPtr< ElementT >(elements, slot);
 	}
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(ElementVector< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element->GetState()) {
-				element = MakeUnique< ElementT >(
-					std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >([&elements, index]() noexcept {
-						return static_cast< ElementT* >(elements[index].get());
-				});
-			}
-
-			++index;
-		}
-
-		elements.push_back(MakeUnique< ElementT >(
+		const auto slot = elements.emplace(MakeUnique< ElementT >(
 			std::forward< ConstructorArgsT >(args)...));
-		return ProxyPtr< ElementT >([&elements, index]() noexcept {
-				return static_cast< ElementT * >(elements[index].get());
-		});
+		return ProxyPtr< ElementT >(elements, slot);
 	}
 }
\ No newline at end of file
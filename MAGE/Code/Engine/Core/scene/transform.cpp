@@ -13,8 +13,14 @@
 namespace mage {
 
 	void Transform::SetDirty() const noexcept {
+		// The descendants of a dirty transform are dirty as well.
+		if (m_dirty_object_to_world && m_dirty_world_to_object) {
+			return;
+		}
+
 		m_dirty_object_to_world = true;
 		m_dirty_world_to_object = true;
+		m_version               = GetNextGuid();
 
 		if (HasOwner()) {
 			m_owner->ForEachChild([](const Node& node) noexcept {
@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "parallel\id_generator.hpp"
 #include "transform\transform.hpp"
 
 #pragma endregion
@@ -42,6 +43,7 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
+			m_version(GetNextGuid()),
 			m_owner() {}
 
 		/**
@@ -56,6 +58,7 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
+			m_version(GetNextGuid()),
 			m_owner() {}
 
 		/**
@@ -1440,6 +1443,19 @@ namespace mage {
 		//---------------------------------------------------------------------
 		#pragma region
 
+		/**
+		 Returns the version of this transform.
+
+		 The version changes whenever this transform or one of its ancestors
+		 changes. Versions are unique across all transforms.
+
+		 @return		The version of this transform.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept {
+			return m_version;
+		}
+
 		/**
 		 Sets this transform to dirty.
 		 */
@@ -1471,6 +1487,23 @@ namespace mage {
 			SetDirty();
 		}
 
+		/**
+		 Sets the cached object-to-world and world-to-object matrices of this
+		 transform to the given matrices.
+
+		 @param[in]		object_to_world
+						The object-to-world matrix.
+		 @param[in]		world_to_object
+						The world-to-object matrix.
+		 */
+		void XM_CALLCONV SetWorldMatrices(FXMMATRIX object_to_world,
+										  CXMMATRIX world_to_object) const noexcept {
+			m_object_to_world       = object_to_world;
+			m_world_to_object       = world_to_object;
+			m_dirty_object_to_world = false;
+			m_dirty_world_to_object = false;
+		}
+
 		/**
 		 Updates the object-to-world matrix of this transform if dirty.
 
@@ -1518,6 +1551,11 @@ namespace mage {
 		 */
 		mutable bool m_dirty_world_to_object;
 
+		/**
+		 The version of this transform.
+		 */
+		mutable U64 m_version;
+
 		/**
 		 A pointer to the node owning this transform.
 		 */
@@ -1543,6 +1581,7 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		friend class Node;
+		friend class TransformHierarchy;
 
 		//---------------------------------------------------------------------
 		// Static Member Methods
@@ -1561,6 +1600,24 @@ namespace mage {
 
 			transform.SetOwner(std::move(owner));
 		}
+
+		/**
+		 Sets the cached object-to-world and world-to-object matrices of the
+		 given transform to the given matrices.
+
+		 @param[in]		transform
+						A reference to the transform.
+		 @param[in]		object_to_world
+						The object-to-world matrix.
+		 @param[in]		world_to_object
+						The world-to-object matrix.
+		 */
+		static void XM_CALLCONV SetWorldMatrices(const Transform& transform,
+												 FXMMATRIX object_to_world,
+												 CXMMATRIX world_to_object) noexcept {
+
+			transform.SetWorldMatrices(object_to_world, world_to_object);
+		}
 	};
 
 	#pragma endregion
@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\transform_hierarchy.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The version of transforms which are not updated yet. Transform
+		 versions are guids and never reach this value.
+		 */
+		constexpr U64 g_no_version = std::numeric_limits< U64 >::max();
+	}
+
+	TransformHierarchy::TransformHierarchy() noexcept
+		: m_nodes(),
+		m_parents(),
+		m_versions(),
+		m_updated(),
+		m_object_to_world(),
+		m_world_to_object(),
+		m_hierarchy_version(g_no_version),
+		m_nb_nodes(0u) {}
+
+	void TransformHierarchy::Clear() noexcept {
+		m_nodes.clear();
+		m_parents.clear();
+		m_versions.clear();
+		m_updated.clear();
+		m_object_to_world.clear();
+		m_world_to_object.clear();
+		m_hierarchy_version = g_no_version;
+		m_nb_nodes          = 0u;
+	}
+
+	void TransformHierarchy::Rebuild(const ElementVector< Node >& nodes) {
+		m_nodes.clear();
+		m_parents.clear();
+
+		// Add the root nodes.
+		for (std::size_t i = 0u; i < nodes.size(); ++i) {
+			const auto& node = nodes[i];
+			if (State::Terminated != node.GetState() && !node.HasParent()) {
+				m_nodes.push_back(static_cast< U32 >(i));
+				m_parents.push_back(s_no_parent);
+			}
+		}
+
+		// Add the childs of each added node in breadth-first order. The childs
+		// of a node are contained in the same vector as the node itself.
+		for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+			const auto parent = static_cast< U32 >(i);
+			nodes[m_nodes[i]].ForEachChild([this, &nodes, parent](const Node& node) {
+				m_nodes.push_back(static_cast< U32 >(&node - nodes.data()));
+				m_parents.push_back(parent);
+			});
+		}
+
+		const auto nb_nodes = m_nodes.size();
+		m_versions.assign(nb_nodes, g_no_version);
+		m_updated.assign(nb_nodes, U8(0u));
+		m_object_to_world.resize(nb_nodes);
+		m_world_to_object.resize(nb_nodes);
+
+		m_hierarchy_version = Node::GetHierarchyVersion();
+		m_nb_nodes          = nodes.size();
+	}
+
+	void TransformHierarchy::Update(const ElementVector< Node >& nodes) {
+		if (Node::GetHierarchyVersion() != m_hierarchy_version
+			|| nodes.size() != m_nb_nodes) {
+
+			Rebuild(nodes);
+		}
+
+		for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+			const auto& transform = nodes[m_nodes[i]].GetTransform();
+			const auto  parent    = m_parents[i];
+			const auto  version   = transform.GetVersion();
+
+			// Parents precede their childs, so the parent is up to date.
+			const auto dirty = version != m_versions[i]
+				            || (s_no_parent != parent && m_updated[parent]);
+			m_updated[i] = dirty;
+			if (!dirty) {
+				continue;
+			}
+
+			auto object_to_world = transform.GetObjectToParentMatrix();
+			auto world_to_object = transform.GetParentToObjectMatrix();
+			if (s_no_parent != parent) {
+				object_to_world = object_to_world * m_object_to_world[parent];
+				world_to_object = m_world_to_object[parent] * world_to_object;
+			}
+
+			m_object_to_world[i] = object_to_world;
+			m_world_to_object[i] = world_to_object;
+			m_versions[i]        = version;
+
+			TransformClient::SetWorldMatrices(transform,
+											  object_to_world,
+											  world_to_object);
+		}
+	}
+}
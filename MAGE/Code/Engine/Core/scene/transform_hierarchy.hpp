@@ -0,0 +1,176 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\node.hpp"
+#include "scene\element_vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of transform hierarchies.
+
+	 A transform hierarchy flattens the node hierarchies of a vector of nodes
+	 into contiguous arrays in which each parent precedes its childs. The
+	 world matrices of all nodes are updated in a single linear pass over
+	 these arrays, which only recomputes the transforms that changed since
+	 the previous update and their descendants. The flattened order is only
+	 rebuilt if the node hierarchies change.
+	 */
+	class TransformHierarchy {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a transform hierarchy.
+		 */
+		TransformHierarchy() noexcept;
+
+		/**
+		 Constructs a transform hierarchy from the given transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 */
+		TransformHierarchy(const TransformHierarchy& hierarchy) = default;
+
+		/**
+		 Constructs a transform hierarchy by moving the given transform
+		 hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 */
+		TransformHierarchy(TransformHierarchy&& hierarchy) noexcept = default;
+
+		/**
+		 Destructs this transform hierarchy.
+		 */
+		~TransformHierarchy() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 @return		A reference to the copy of the given transform
+						hierarchy (i.e. this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(const TransformHierarchy& hierarchy) = default;
+
+		/**
+		 Moves the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 @return		A reference to the moved transform hierarchy (i.e.
+						this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(TransformHierarchy&& hierarchy) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the world matrices of the transforms of the given nodes.
+
+		 @param[in]		nodes
+						A reference to an element vector containing the
+						nodes.
+		 */
+		void Update(const ElementVector< Node >& nodes);
+
+		/**
+		 Clears this transform hierarchy.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The parent index of root nodes.
+		 */
+		static constexpr U32 s_no_parent = U32(-1);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rebuilds the flattened order of the given nodes.
+
+		 @param[in]		nodes
+						A reference to an element vector containing the
+						nodes.
+		 */
+		void Rebuild(const ElementVector< Node >& nodes);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the indices of the nodes in flattened order.
+		 */
+		std::vector< U32 > m_nodes;
+
+		/**
+		 A vector containing the flattened index of the parent of each node,
+		 or @c s_no_parent for root nodes.
+		 */
+		std::vector< U32 > m_parents;
+
+		/**
+		 A vector containing the version of the transform of each node at
+		 its last update.
+		 */
+		std::vector< U64 > m_versions;
+
+		/**
+		 A vector containing a flag for each node indicating whether its
+		 world matrices were updated during the last update.
+		 */
+		std::vector< U8 > m_updated;
+
+		/**
+		 A vector containing the object-to-world matrix of each node.
+		 */
+		AlignedVector< XMMATRIX > m_object_to_world;
+
+		/**
+		 A vector containing the world-to-object matrix of each node.
+		 */
+		AlignedVector< XMMATRIX > m_world_to_object;
+
+		/**
+		 The version of the node hierarchies at the last rebuild.
+		 */
+		U64 m_hierarchy_version;
+
+		/**
+		 The number of nodes at the last rebuild.
+		 */
+		std::size_t m_nb_nodes;
+	};
+}
@@ -33,6 +33,33 @@ namespace mage {
 
 	BRDFScene::~BRDFScene() = default;
 
+	void BRDFScene::LoadResources([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_factory = engine.GetRenderingManager().GetResourceManager();
+
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/teapot/teapot.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/skull/skull.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/cone/cone.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/cube/cube.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/cylinder/cylinder.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/plane/plane.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/sphere/sphere.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/torus/torus.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< Texture >(
+			L"assets/textures/sky/sky.dds"));
+	}
+
 	void BRDFScene::Load([[maybe_unused]] Engine& engine) {
 		using namespace rendering;
 
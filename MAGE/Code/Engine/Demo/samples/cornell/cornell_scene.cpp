@@ -35,6 +35,19 @@ namespace mage {
 
 	CornellScene::~CornellScene() = default;
 
+	void CornellScene::LoadResources([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_factory = engine.GetRenderingManager().GetResourceManager();
+
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/cube/cube.obj", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/plane/plane.obj", mesh_desc));
+	}
+
 	void CornellScene::Load([[maybe_unused]] Engine& engine) {
 		using namespace rendering;
 
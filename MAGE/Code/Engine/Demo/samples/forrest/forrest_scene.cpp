@@ -36,6 +36,37 @@ namespace mage {
 
 	ForrestScene::~ForrestScene() = default;
 
+	void ForrestScene::LoadResources([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_factory = engine.GetRenderingManager().GetResourceManager();
+
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/plane/plane.obj", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree1a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree1b_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree2a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree2b_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree3a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree3b_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree4a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree4b_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/windmill/windmill.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< Texture >(
+			L"assets/textures/sky/sky.dds"));
+	}
+
 	void ForrestScene::Load([[maybe_unused]] Engine& engine) {
 		using namespace rendering;
 
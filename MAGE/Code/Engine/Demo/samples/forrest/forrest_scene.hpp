@@ -32,6 +32,7 @@ namespace mage {
 
 	private:
 
+		virtual void LoadResources([[maybe_unused]] Engine& engine) override;
 		virtual void Load([[maybe_unused]] Engine& engine) override;
 	};
 }
\ No newline at end of file
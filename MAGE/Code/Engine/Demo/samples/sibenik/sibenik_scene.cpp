@@ -36,6 +36,21 @@ namespace mage {
 
 	SibenikScene::~SibenikScene() = default;
 
+	void SibenikScene::LoadResources([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_factory = engine.GetRenderingManager().GetResourceManager();
+
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/sibenik/sibenik.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree1a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< Texture >(
+			L"assets/textures/sky/sky.dds"));
+	}
+
 	void SibenikScene::Load([[maybe_unused]] Engine& engine) {
 		using namespace rendering;
 
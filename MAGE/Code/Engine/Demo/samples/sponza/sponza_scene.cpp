@@ -37,6 +37,25 @@ namespace mage {
 
 	SponzaScene::~SponzaScene() = default;
 
+	void SponzaScene::LoadResources([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_factory = engine.GetRenderingManager().GetResourceManager();
+
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/teapot/teapot.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/plane/plane.obj", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/sponza/sponza.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< ModelDescriptor >(
+			L"assets/models/tree/tree1a_lod0.mdl", mesh_desc));
+		AddResource(rendering_factory.GetOrCreateAsync< Texture >(
+			L"assets/textures/sky/sky.dds"));
+	}
+
 	void SponzaScene::Load([[maybe_unused]] Engine& engine) {
 		using namespace rendering;
 
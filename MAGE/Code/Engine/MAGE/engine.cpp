@@ -10,6 +10,7 @@
 #include "meta\targetver.hpp"
 #include "meta\version.hpp"
 #include "scene\scene.hpp"
+#include "scene\script\behavior_script_scheduler.hpp"
 
 #pragma endregion
 
@@ -124,15 +125,19 @@ namespace mage {
 		m_message_handler(),
 		m_input_manager(),
 		m_rendering_manager(),
+		m_job_system(),
+		m_script_scheduler(),
 		m_scene(),
 		m_requested_scene(),
+		m_preloading_scene(),
 		m_timer(),
 		m_time(),
 		m_fixed_delta_time(TimeIntervalSeconds::zero()),
 		m_fixed_time_budget(TimeIntervalSeconds::zero()),
 		m_deactive(false),
 		m_mode_switch(false),
-		m_has_requested_scene(false) {
+		m_has_requested_scene(false),
+		m_parallel_scripting(true) {
 
 		// Initialize the systems of this engine.
 		InitializeSystems(setup, display_config);
@@ -190,8 +195,14 @@ namespace mage {
 		// Initialize the input system.
 		m_input_manager = MakeUnique< input::Manager >(window);
 
+		// Initialize the job system.
+		m_job_system       = MakeUnique< JobSystem >();
+		m_script_scheduler = MakeUnique< BehaviorScriptScheduler >();
+
 		// Initialize the rendering system.
-		m_rendering_manager = MakeUnique< rendering::Manager >(window, display_config);
+		m_rendering_manager = MakeUnique< rendering::Manager >(window,
+															   display_config,
+															   *m_job_system);
 		m_rendering_manager->BindPersistentState();
 
 		// Initializes the COM library for use by the calling thread and sets
@@ -208,17 +219,32 @@ namespace mage {
 
 		// Uninitialize the scene system.
 		m_scene.reset();
+		m_preloading_scene.reset();
 		// Uninitialize the rendering system.
 		m_rendering_manager.reset();
 		// Uninitialize the input system.
 		m_input_manager.reset();
 		// Uninitialize the window system.
 		m_window.reset();
+		// Uninitialize the job system.
+		m_script_scheduler.reset();
+		m_job_system.reset();
 	}
 
 	void Engine::RequestScene(UniquePtr< Scene >&& scene) noexcept {
 		m_requested_scene     = std::move(scene);
 		m_has_requested_scene = true;
+		m_preloading_scene    = nullptr;
+	}
+
+	void Engine::PreloadScene(UniquePtr< Scene >&& scene) {
+		m_preloading_scene = nullptr;
+
+		if (scene) {
+			scene->Preload(*this);
+		}
+
+		m_preloading_scene = std::move(scene);
 	}
 
 	void Engine::ApplyRequestedScene() {
@@ -272,35 +298,39 @@ namespace mage {
 
 	[[nodiscard]]
 	bool Engine::UpdateScripting() {
+		const auto job_system = m_parallel_scripting ? m_job_system.get()
+			                                         : nullptr;
+		const BehaviorScriptScheduler::ScriptAction fixed_update
+			= [this](BehaviorScript& script) {
+			script.FixedUpdate(*this);
+		};
+
 		// Perform the fixed delta time updates of the current scene.
 		if (TimeIntervalSeconds::zero() != m_fixed_delta_time) {
 			m_fixed_time_budget += m_time.GetWallClockDeltaTime();
 			while (m_fixed_time_budget >= m_fixed_delta_time) {
-				m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-					if (State::Active == script.GetState()) {
-						script.FixedUpdate(*this);
-					}
-				});
+				m_script_scheduler->Execute(*m_scene, fixed_update, job_system);
 
 				m_fixed_time_budget -= m_fixed_delta_time;
 			}
 		}
 		else {
-			m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-				if (State::Active == script.GetState()) {
-					script.FixedUpdate(*this);
-				}
-			});
+			m_script_scheduler->Execute(*m_scene, fixed_update, job_system);
 		}
 
 		// Perform the non-fixed delta time updates of the current scene.
-		m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-			if (State::Active == script.GetState()
-				&& !m_has_requested_scene) {
-
+		// Scene requests originate from exclusive behavior scripts only.
+		m_script_scheduler->Execute(*m_scene, [this](BehaviorScript& script) {
+			if (!m_has_requested_scene) {
 				script.Update(*this);
 			}
-		});
+		}, job_system);
+
+		// Swap in the preloading scene once all its resources are loaded.
+		if (!m_has_requested_scene
+			&& m_preloading_scene && m_preloading_scene->IsPreloaded()) {
+			RequestScene(std::move(m_preloading_scene));
+		}
 
 		if (m_has_requested_scene) {
 			ApplyRequestedScene();
@@ -366,6 +396,8 @@ namespace mage {
 				continue;
 			}
 
+			m_scene->UpdateTransforms();
+
 			m_rendering_manager->Render(m_time);
 		}
 
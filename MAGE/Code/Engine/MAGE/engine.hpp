@@ -8,6 +8,7 @@
 #include "engine_setup.hpp"
 #include "input_manager.hpp"
 #include "rendering_manager.hpp"
+#include "parallel\job_system.hpp"
 #include "ui\window.hpp"
 
 #pragma endregion
@@ -131,8 +132,9 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	// Forward dclaration.
+	// Forward dclarations.
 	class Scene;
+	class BehaviorScriptScheduler;
 
 	/**
 	 A class of engines.
@@ -241,6 +243,41 @@ namespace mage {
 			return *m_rendering_manager;
 		}
 
+		/**
+		 Returns the job system of this engine.
+
+		 @return		A reference to the job system of this engine.
+		 */
+		[[nodiscard]]
+		JobSystem& GetJobSystem() noexcept {
+			return *m_job_system;
+		}
+
+		/**
+		 Checks whether this engine updates behavior scripts in parallel.
+
+		 @return		@c true if this engine updates behavior scripts in
+						parallel. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsParallelScripting() const noexcept {
+			return m_parallel_scripting;
+		}
+
+		/**
+		 Sets the parallel scripting flag of this engine to the given value.
+
+		 If parallel scripting is disabled, all behavior scripts are updated
+		 sequentially in scene order, which eases debugging.
+
+		 @param[in]		parallel_scripting
+						@c true if this engine needs to update behavior
+						scripts in parallel. @c false otherwise.
+		 */
+		void SetParallelScripting(bool parallel_scripting) noexcept {
+			m_parallel_scripting = parallel_scripting;
+		}
+
 		/**
 		 Returns the current scene of this engine.
 
@@ -259,6 +296,20 @@ namespace mage {
 		 */
 		void RequestScene(UniquePtr< Scene >&& scene) noexcept;
 
+		/**
+		 Preloads the given scene. The resources of the given scene are
+		 loaded in the background while the current scene keeps running.
+		 Once all these resources finished loading, the given scene replaces
+		 the current scene. A preloading scene is discarded if another scene
+		 is requested or preloaded.
+
+		 @param[in]		scene
+						A reference to the scene to preload.
+		 @throws		Exception
+						Failed to preload the given scene.
+		 */
+		void PreloadScene(UniquePtr< Scene >&& scene);
+
 		/**
 		 Returns the game time of this game engine.
 
@@ -328,6 +379,16 @@ namespace mage {
 		 */
 		UniquePtr< rendering::Manager > m_rendering_manager;
 
+		/**
+		 A pointer to the job system of this engine.
+		 */
+		UniquePtr< JobSystem > m_job_system;
+
+		/**
+		 A pointer to the behavior script scheduler of this engine.
+		 */
+		UniquePtr< BehaviorScriptScheduler > m_script_scheduler;
+
 		/**
 		 A pointer to the current scene of this engine.
 		 */
@@ -338,6 +399,11 @@ namespace mage {
 		 */
 		UniquePtr< Scene > m_requested_scene;
 
+		/**
+		 A pointer to the preloading scene of this engine.
+		 */
+		UniquePtr< Scene > m_preloading_scene;
+
 		/**
 		 The timer of this engine.
 		 */
@@ -379,6 +445,12 @@ namespace mage {
 		 @c nullptr.
 		 */
 		bool m_has_requested_scene;
+
+		/**
+		 A flag indicating whether this engine updates behavior scripts in
+		 parallel.
+		 */
+		bool m_parallel_scripting;
 	};
 
 	#pragma endregion
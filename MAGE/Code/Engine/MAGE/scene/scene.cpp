@@ -8,6 +8,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -16,7 +25,10 @@ namespace mage {
 	Scene::Scene(std::string name)
 		: m_name(std::move(name)),
 		m_nodes(),
-		m_scripts() {}
+		m_scripts(),
+		m_transform_hierarchy(),
+		m_resources(),
+		m_preloaded(false) {}
 
 	Scene::Scene(Scene&& scene) noexcept = default;
 
@@ -28,7 +40,29 @@ namespace mage {
 	// Scene Member Methods: Lifecycle
 	//-------------------------------------------------------------------------
 
+	void Scene::Preload(Engine& engine) {
+		// Loads the resources of this scene.
+		LoadResources(engine);
+
+		m_preloaded = true;
+	}
+
+	[[nodiscard]]
+	bool Scene::IsPreloaded() const {
+		return m_preloaded
+			&& std::all_of(m_resources.cbegin(), m_resources.cend(),
+						   [](const auto& is_ready) {
+							   return is_ready(false);
+						   });
+	}
+
 	void Scene::Initialize(Engine& engine) {
+		// Waits for the resources of this scene. The resources of a scene
+		// which is not preloaded are loaded by its Load instead.
+		for (const auto& is_ready : m_resources) {
+			is_ready(true);
+		}
+
 		// Loads this scene.
 		Load(engine);
 
@@ -36,6 +70,10 @@ namespace mage {
 		ForEach< BehaviorScript >([&engine](BehaviorScript& script) {
 			script.Load(engine);
 		});
+
+		// Removes the nodes, scripts and components terminated while loading.
+		Compact();
+		engine.GetRenderingManager().GetWorld().Compact();
 	}
 
 	void Scene::Uninitialize(Engine& engine) {
@@ -53,6 +91,8 @@ namespace mage {
 		Clear();
 	}
 
+	void Scene::LoadResources([[maybe_unused]] Engine& engine) {}
+
 	void Scene::Load([[maybe_unused]] Engine& engine) {}
 
 	void Scene::Close([[maybe_unused]] Engine& engine) {}
@@ -60,6 +100,9 @@ namespace mage {
 	void Scene::Clear() noexcept {
 		m_nodes.clear();
 		m_scripts.clear();
+		m_transform_hierarchy.Clear();
+		m_resources.clear();
+		m_preloaded = false;
 	}
 
 	//-------------------------------------------------------------------------
@@ -159,4 +202,13 @@ namespace mage {
 
 		return root;
 	}
+
+	void Scene::UpdateTransforms() {
+		m_transform_hierarchy.Update(m_nodes);
+	}
+
+	void Scene::Compact() {
+		m_nodes.compact();
+		m_scripts.compact();
+	}
 }
\ No newline at end of file
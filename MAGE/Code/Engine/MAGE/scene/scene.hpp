@@ -8,7 +8,18 @@
 #include "engine.hpp"
 #include "scene\node.hpp"
 #include "scene\scene_utils.hpp"
+#include "scene\transform_hierarchy.hpp"
 #include "scene\script\behavior_script.hpp"
+#include "resource\resource_future.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
 
 #pragma endregion
 
@@ -61,7 +72,31 @@ namespace mage {
 		//-------------------------------------------------------------------------
 
 		/**
-		 Initializes this scene.
+		 Starts loading the resources of this scene in the background. This
+		 scene retains these resources till it is uninitialized.
+
+		 @param[in,out]	engine
+						A reference to the engine.
+		 @throws		Exception
+						Failed to preload this scene.
+		 */
+		void Preload(Engine& engine);
+
+		/**
+		 Checks whether all resources of this scene finished loading.
+
+		 @return		@c true if this scene is preloaded and all its
+						resources finished loading. @c false otherwise.
+		 @throws		Exception
+						Failed to load a resource of this scene.
+		 */
+		[[nodiscard]]
+		bool IsPreloaded() const;
+
+		/**
+		 Initializes this scene. If this scene is preloaded, this scene waits
+		 for its resources to finish loading first. Otherwise, this scene
+		 loads its resources while it is loaded.
 
 		 @param[in,out]	engine
 						A reference to the engine.
@@ -108,6 +143,18 @@ namespace mage {
 		template< typename ElementT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		/**
+		 Updates the world matrices of the transforms of the nodes of this
+		 scene.
+		 */
+		void UpdateTransforms();
+
+		/**
+		 Removes the terminated nodes and scripts of this scene. Proxy
+		 pointers to the remaining nodes and scripts remain valid.
+		 */
+		void Compact();
+
 		//---------------------------------------------------------------------
 		// Member Methods: Identification
 		//---------------------------------------------------------------------
@@ -172,12 +219,41 @@ namespace mage {
 		 */
 		Scene(Scene&& scene) noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Resources
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given resource future to the resources of this scene.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		future
+						The resource future.
+		 */
+		template< typename ResourceT >
+		void AddResource(ResourceFuture< ResourceT > future);
+
 	private:
 
 		//---------------------------------------------------------------------
 		// Member Methods: Lifecycle
 		//---------------------------------------------------------------------
 
+		/**
+		 Loads the resources of this scene. Allows this scene to request its
+		 resources asynchronously (and to add them with @c AddResource)
+		 before this scene is loaded. These resources finished loading when
+		 this scene is loaded. This method is only called when preloading
+		 this scene.
+
+		 @param[in,out]	engine
+						A reference to the engine.
+		 @throws		Exception
+						Failed to load the resources of this scene.
+		 */
+		virtual void LoadResources([[maybe_unused]] Engine& engine);
+
 		/**
 		 Loads this scene. Allows this scene to preform any pre-processing
 		 construction.
@@ -212,12 +288,34 @@ namespace mage {
 		/**
 		 A vector containing the nodes of this scene.
 		 */
-		AlignedVector< Node > m_nodes;
+		ElementVector< Node > m_nodes;
 
 		/**
 		 A vector containing the pointers to the scripts of this scene.
 		 */
-		AlignedVector< UniquePtr< BehaviorScript > > m_scripts;
+		ElementVector< UniquePtr< BehaviorScript > > m_scripts;
+
+		/**
+		 The transform hierarchy of the nodes of this scene.
+		 */
+		TransformHierarchy m_transform_hierarchy;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Resources
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the readiness checks of the resources of this
+		 scene. Each readiness check retains its resource, waits for its
+		 resource to finish loading if requested, and rethrows the exception
+		 of a failed load.
+		 */
+		std::vector< std::function< bool(bool) > > m_resources;
+
+		/**
+		 A flag indicating whether this scene is preloaded.
+		 */
+		bool m_preloaded;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Identification
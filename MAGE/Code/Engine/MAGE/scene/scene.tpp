@@ -32,6 +32,26 @@ namespace mage {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Scene: Resources
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename ResourceT >
+	inline void Scene::AddResource(ResourceFuture< ResourceT > future) {
+		m_resources.push_back([future(std::move(future))](bool wait) {
+			if (!wait && !future.IsReady()) {
+				return false;
+			}
+
+			// Rethrows the exception of a failed load.
+			future.Wait();
+			return true;
+		});
+	}
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Scene: Count
 	//-------------------------------------------------------------------------
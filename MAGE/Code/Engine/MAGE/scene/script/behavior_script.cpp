@@ -34,4 +34,11 @@ namespace mage {
 	void BehaviorScript::Update([[maybe_unused]] Engine& engine) {}
 
 	void BehaviorScript::Close([[maybe_unused]] Engine& engine) {}
+
+	[[nodiscard]]
+	bool BehaviorScript::GetWrittenNodes(
+		[[maybe_unused]] std::vector< const Node* >& nodes) const {
+
+		return false;
+	}
 }
\ No newline at end of file
@@ -105,6 +105,34 @@ namespace mage {
 		 */
 		virtual void Close([[maybe_unused]] Engine& engine);
 
+		//---------------------------------------------------------------------
+		// Member Methods: Scheduling
+		//---------------------------------------------------------------------
+
+		/**
+		 Appends the nodes written by this behavior script to the given
+		 vector.
+
+		 Behavior scripts which declare their written nodes, are updated in
+		 parallel with behavior scripts writing nodes of other node
+		 hierarchies. Writing a node includes writing its transform and
+		 components, and reading any node of its node hierarchy. Apart from
+		 its written nodes, such a behavior script may only read state which
+		 does not change while updating behavior scripts (e.g., the game time
+		 and the input).
+
+		 @param[in,out]	nodes
+						A reference to a vector to append the written nodes
+						to.
+		 @return		@c true if this behavior script only writes the
+						appended nodes. @c false if this behavior script may
+						access arbitrary state and needs to be updated
+						exclusively.
+		 */
+		[[nodiscard]]
+		virtual bool GetWrittenNodes(
+			[[maybe_unused]] std::vector< const Node* >& nodes) const;
+
 	protected:
 
 		//---------------------------------------------------------------------
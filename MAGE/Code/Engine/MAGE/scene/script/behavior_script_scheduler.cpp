@@ -0,0 +1,216 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\behavior_script_scheduler.hpp"
+#include "scene\scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <exception>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	BehaviorScriptScheduler::BehaviorScriptScheduler() noexcept = default;
+
+	BehaviorScriptScheduler::BehaviorScriptScheduler(
+		BehaviorScriptScheduler&& scheduler) noexcept = default;
+
+	BehaviorScriptScheduler::~BehaviorScriptScheduler() = default;
+
+	BehaviorScriptScheduler& BehaviorScriptScheduler
+		::operator=(BehaviorScriptScheduler&& scheduler) noexcept = default;
+
+	void BehaviorScriptScheduler::Execute(Scene& scene,
+										  const ScriptAction& action,
+										  JobSystem* job_system) {
+
+		if (nullptr == job_system) {
+			scene.ForEach< BehaviorScript >([&action](BehaviorScript& script) {
+				if (State::Active == script.GetState()) {
+					action(script);
+				}
+			});
+
+			return;
+		}
+
+		// Discard the batch of a previous execution which failed.
+		m_scripts.clear();
+		m_script_groups.clear();
+		m_group_parents.clear();
+		m_root_groups.clear();
+
+		scene.ForEach< BehaviorScript >([this, &action, job_system](
+			BehaviorScript& script) {
+
+			if (State::Active != script.GetState()) {
+				return;
+			}
+
+			m_nodes.clear();
+			if (script.GetWrittenNodes(m_nodes)) {
+				Add(script);
+				return;
+			}
+
+			// Exclusive behavior scripts see the effects of all preceding
+			// behavior scripts, and vice versa.
+			Flush(action, *job_system);
+			action(script);
+		});
+
+		Flush(action, *job_system);
+	}
+
+	void BehaviorScriptScheduler::Add(BehaviorScript& script) {
+		const auto group = static_cast< U32 >(m_group_parents.size());
+		m_group_parents.push_back(group);
+
+		auto representative = group;
+		for (auto node : m_nodes) {
+			if (nullptr == node) {
+				continue;
+			}
+
+			// Writing a node dirties its descendants and reading a node
+			// updates its ancestors, so conflicts are detected per node
+			// hierarchy.
+			for (auto parent = node->GetParent(); parent;
+				 parent = parent->GetParent()) {
+
+				node = parent.Get();
+			}
+
+			const auto [it, inserted]
+				= m_root_groups.try_emplace(node, representative);
+			if (!inserted) {
+				representative = MergeGroups(it->second, representative);
+			}
+		}
+
+		m_scripts.push_back(&script);
+		m_script_groups.push_back(group);
+	}
+
+	void BehaviorScriptScheduler::Flush(const ScriptAction& action,
+										JobSystem& job_system) {
+		if (m_scripts.empty()) {
+			return;
+		}
+
+		for (auto& group : m_script_groups) {
+			group = FindGroup(group);
+		}
+
+		// Number the non-empty groups densely.
+		std::fill(m_group_parents.begin(), m_group_parents.end(), s_no_group);
+		U32 nb_groups = 0u;
+		for (auto& group : m_script_groups) {
+			auto& dense_group = m_group_parents[group];
+			if (s_no_group == dense_group) {
+				dense_group = nb_groups++;
+			}
+
+			group = dense_group;
+		}
+
+		if (1u == nb_groups) {
+			for (const auto script : m_scripts) {
+				if (State::Active == script->GetState()) {
+					action(*script);
+				}
+			}
+		}
+		else {
+			// Sort the behavior scripts by group while preserving their
+			// order within each group.
+			m_group_offsets.assign(nb_groups + 1u, 0u);
+			for (const auto group : m_script_groups) {
+				++m_group_offsets[group + 1u];
+			}
+			for (U32 group = 0u; group < nb_groups; ++group) {
+				m_group_offsets[group + 1u] += m_group_offsets[group];
+			}
+
+			m_group_parents.assign(m_group_offsets.cbegin(),
+								   m_group_offsets.cend() - 1);
+			m_sorted_scripts.resize(m_scripts.size());
+			for (std::size_t i = 0u; i < m_scripts.size(); ++i) {
+				const auto group = m_script_groups[i];
+				m_sorted_scripts[m_group_parents[group]++] = m_scripts[i];
+			}
+
+			std::atomic< bool > failed(false);
+			std::exception_ptr exception;
+
+			job_system.ParallelFor(0u, nb_groups,
+				[this, &action, &failed, &exception](std::size_t group) {
+
+				const auto begin = m_group_offsets[group];
+				const auto end   = m_group_offsets[group + 1u];
+				for (auto i = begin; i < end; ++i) {
+					auto& script = *m_sorted_scripts[i];
+					if (State::Active != script.GetState()) {
+						continue;
+					}
+
+					try {
+						action(script);
+					}
+					catch (...) {
+						if (!failed.exchange(true)) {
+							exception = std::current_exception();
+						}
+						return;
+					}
+				}
+			});
+
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+
+		m_scripts.clear();
+		m_script_groups.clear();
+		m_group_parents.clear();
+		m_root_groups.clear();
+	}
+
+	[[nodiscard]]
+	U32 BehaviorScriptScheduler::FindGroup(U32 group) noexcept {
+		while (m_group_parents[group] != group) {
+			// Path halving
+			m_group_parents[group] = m_group_parents[m_group_parents[group]];
+			group = m_group_parents[group];
+		}
+
+		return group;
+	}
+
+	U32 BehaviorScriptScheduler::MergeGroups(U32 group1, U32 group2) noexcept {
+		group1 = FindGroup(group1);
+		group2 = FindGroup(group2);
+
+		// The group of the earliest behavior script represents the merged
+		// groups.
+		if (group2 < group1) {
+			std::swap(group1, group2);
+		}
+
+		m_group_parents[group2] = group1;
+		return group1;
+	}
+}
@@ -0,0 +1,239 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\behavior_script.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	// Forward declaration.
+	class Scene;
+
+	/**
+	 A class of behavior script schedulers.
+
+	 A behavior script scheduler partitions the behavior scripts of a scene
+	 in batches, separated by the behavior scripts which need to be updated
+	 exclusively. The behavior scripts of a batch are grouped by the node
+	 hierarchies they write. The groups of a batch are updated in parallel,
+	 while the behavior scripts of a group are updated sequentially in scene
+	 order.
+	 */
+	class BehaviorScriptScheduler {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of behavior script actions.
+		 */
+		using ScriptAction = std::function< void(BehaviorScript&) >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a behavior script scheduler.
+		 */
+		BehaviorScriptScheduler() noexcept;
+
+		/**
+		 Constructs a behavior script scheduler from the given behavior script
+		 scheduler.
+
+		 @param[in]		scheduler
+						A reference to the behavior script scheduler to copy.
+		 */
+		BehaviorScriptScheduler(const BehaviorScriptScheduler& scheduler) = delete;
+
+		/**
+		 Constructs a behavior script scheduler by moving the given behavior
+		 script scheduler.
+
+		 @param[in]		scheduler
+						A reference to the behavior script scheduler to move.
+		 */
+		BehaviorScriptScheduler(BehaviorScriptScheduler&& scheduler) noexcept;
+
+		/**
+		 Destructs this behavior script scheduler.
+		 */
+		~BehaviorScriptScheduler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given behavior script scheduler to this behavior script
+		 scheduler.
+
+		 @param[in]		scheduler
+						A reference to the behavior script scheduler to copy.
+		 @return		A reference to the copy of the given behavior script
+						scheduler (i.e. this behavior script scheduler).
+		 */
+		BehaviorScriptScheduler& operator=(
+			const BehaviorScriptScheduler& scheduler) = delete;
+
+		/**
+		 Moves the given behavior script scheduler to this behavior script
+		 scheduler.
+
+		 @param[in]		scheduler
+						A reference to the behavior script scheduler to move.
+		 @return		A reference to the moved behavior script scheduler
+						(i.e. this behavior script scheduler).
+		 */
+		BehaviorScriptScheduler& operator=(
+			BehaviorScriptScheduler&& scheduler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Applies the given action to all active behavior scripts of the given
+		 scene.
+
+		 @param[in,out]	scene
+						A reference to the scene.
+		 @param[in]		action
+						A reference to the action.
+		 @param[in]		job_system
+						A pointer to the job system. If @c nullptr, all
+						behavior scripts are updated sequentially in scene
+						order.
+		 @throws		Exception
+						Failed to update a behavior script.
+		 */
+		void Execute(Scene& scene,
+					 const ScriptAction& action,
+					 JobSystem* job_system);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The group indicating no group.
+		 */
+		static constexpr U32 s_no_group = U32(-1);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given behavior script to the current batch of this behavior
+		 script scheduler.
+
+		 @param[in]		script
+						A reference to the behavior script.
+		 */
+		void Add(BehaviorScript& script);
+
+		/**
+		 Updates and clears the current batch of this behavior script
+		 scheduler.
+
+		 @param[in]		action
+						A reference to the action.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @throws		Exception
+						Failed to update a behavior script.
+		 */
+		void Flush(const ScriptAction& action, JobSystem& job_system);
+
+		/**
+		 Returns the representative group of the given group.
+
+		 @param[in]		group
+						The group.
+		 @return		The representative group of the given group.
+		 */
+		[[nodiscard]]
+		U32 FindGroup(U32 group) noexcept;
+
+		/**
+		 Merges the given groups.
+
+		 @param[in]		group1
+						The first group.
+		 @param[in]		group2
+						The second group.
+		 @return		The representative group of the merged groups.
+		 */
+		U32 MergeGroups(U32 group1, U32 group2) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the behavior scripts of the current batch of
+		 this behavior script scheduler.
+		 */
+		std::vector< BehaviorScript* > m_scripts;
+
+		/**
+		 A vector containing the group of each behavior script of the
+		 current batch of this behavior script scheduler.
+		 */
+		std::vector< U32 > m_script_groups;
+
+		/**
+		 A vector containing the parent group of each group of the current
+		 batch of this behavior script scheduler.
+		 */
+		std::vector< U32 > m_group_parents;
+
+		/**
+		 A map containing the group of each written node hierarchy (i.e.
+		 root node) of the current batch of this behavior script scheduler.
+		 */
+		std::unordered_map< const Node*, U32 > m_root_groups;
+
+		/**
+		 A vector containing the written nodes of a behavior script.
+		 */
+		std::vector< const Node* > m_nodes;
+
+		/**
+		 A vector containing the behavior scripts of the current batch of
+		 this behavior script scheduler sorted by group.
+		 */
+		std::vector< BehaviorScript* > m_sorted_scripts;
+
+		/**
+		 A vector containing the offset of each group into the sorted
+		 behavior scripts of this behavior script scheduler.
+		 */
+		std::vector< U32 > m_group_offsets;
+	};
+}
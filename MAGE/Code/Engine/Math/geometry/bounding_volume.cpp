@@ -24,6 +24,21 @@ namespace mage {
 		m_max = centroid + radius;
 	}
 
+	[[nodiscard]]
+	const AABB XM_CALLCONV AABB::Transform(const AABB& aabb,
+										   FXMMATRIX transform) noexcept {
+
+		// Transform the centroid and accumulate the absolute contributions
+		// of the radius along each axis (Arvo).
+		const auto centroid = XMVector3Transform(aabb.Centroid(), transform);
+		const auto r        = aabb.Radius();
+		const auto radius   = XMVectorAbs(transform.r[0]) * XMVectorSplatX(r)
+			                + XMVectorAbs(transform.r[1]) * XMVectorSplatY(r)
+			                + XMVectorAbs(transform.r[2]) * XMVectorSplatZ(r);
+
+		return AABB(centroid - radius, centroid + radius);
+	}
+
 	//-------------------------------------------------------------------------
 	// Axis-Aligned Bounding Box: Enclosing = Full Coverage
 	//-------------------------------------------------------------------------
@@ -235,6 +250,15 @@ namespace mage {
 		return true;
 	}
 
+	//-------------------------------------------------------------------------
+	// Bounding Sphere: Overlapping = Partial | Full Coverage
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	bool BoundingSphere::Overlaps(const AABB& aabb) const noexcept {
+		return aabb.Overlaps(*this);
+	}
+
 	//-------------------------------------------------------------------------
 	// Bounding Frustum
 	//-------------------------------------------------------------------------
@@ -367,6 +367,19 @@ namespace mage {
 		// Member Methods: Overlapping = Partial | Full Coverage
 		//---------------------------------------------------------------------
 
+		/**
+		 Checks whether this bounding sphere overlaps the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		@c true if this bounding sphere overlaps @a aabb.
+						@c false otherwise.
+		 @note			This is a (partial or full) coverage test of an AABB
+						with regard to a bounding sphere.
+		 */
+		[[nodiscard]]
+		bool Overlaps(const AABB& aabb) const noexcept;
+
 		/**
 		 Checks whether this bounding sphere overlaps the given bounding
 		 sphere.
@@ -575,6 +588,21 @@ namespace mage {
 			return aabb1.OverlapsStrict(aabb2) ? AABB(p_min, p_max) : AABB();
 		}
 
+		/**
+		 Returns the AABB enclosing the given AABB transformed by the given
+		 (affine) transformation matrix.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The (affine) transformation matrix.
+		 @return		The AABB enclosing @a aabb transformed by
+						@a transform.
+		 */
+		[[nodiscard]]
+		static const AABB XM_CALLCONV Transform(const AABB& aabb,
+												FXMMATRIX transform) noexcept;
+
 		/**
 		 Returns the minimum AABB (i.e. the AABB that is variant for union
 		 operations).
@@ -1193,6 +1221,26 @@ namespace mage {
 		BoundingFrustum& operator=(BoundingFrustum&&
 								   frustum) noexcept = default;
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the plane of this bounding frustum at the given index.
+
+		 The planes are normalized, inward facing and ordered as follows:
+		 left, right, bottom, top, near and far.
+
+		 @pre			@a index is smaller than 6.
+		 @param[in]		index
+						The index of the plane.
+		 @return		The plane of this bounding frustum at the given index.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(std::size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Enclosing = Full Coverage
 		//---------------------------------------------------------------------
@@ -0,0 +1,279 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of SAH bins.
+		 */
+		constexpr std::size_t g_nb_bins = 16u;
+
+		/**
+		 The maximum number of primitives of a leaf node which is always kept
+		 as a leaf node.
+		 */
+		constexpr U32 g_min_leaf_size = 4u;
+
+		/**
+		 The maximum number of primitives of a leaf node.
+		 */
+		constexpr U32 g_max_leaf_size = 16u;
+
+		/**
+		 The depth from which on nodes are split at the median. Median splits
+		 halve the number of primitives, bounding the total depth of a BVH by
+		 64 (i.e. the size of the traversal stack).
+		 */
+		constexpr std::size_t g_max_sah_depth = 32u;
+
+		/**
+		 The SAH cost of traversing a node relative to intersecting a
+		 primitive.
+		 */
+		constexpr F32 g_traversal_cost = 1.0f;
+
+		/**
+		 Returns the surface area of the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		The surface area of @a aabb.
+		 */
+		[[nodiscard]]
+		F32 SurfaceArea(const AABB& aabb) noexcept {
+			const auto d = XMStore< F32x3 >(XMVectorMax(aabb.Diagonal(),
+														XMVectorZero()));
+			return 2.0f * (d[0u] * d[1u] + d[1u] * d[2u] + d[2u] * d[0u]);
+		}
+	}
+
+	void BVH::Clear() noexcept {
+		m_nodes.clear();
+		m_indices.clear();
+		m_aabbs.clear();
+		m_cost       = 0.0f;
+		m_build_cost = 0.0f;
+	}
+
+	void BVH::Build(const AlignedVector< AABB >& aabbs) {
+		Clear();
+
+		const auto nb_aabbs = static_cast< U32 >(aabbs.size());
+		if (0u == nb_aabbs) {
+			return;
+		}
+
+		m_indices.resize(nb_aabbs);
+		std::iota(m_indices.begin(), m_indices.end(), 0u);
+
+		std::vector< F32x3 > centroids;
+		centroids.reserve(nb_aabbs);
+		for (const auto& aabb : aabbs) {
+			centroids.push_back(XMStore< F32x3 >(aabb.Centroid()));
+		}
+
+		m_nodes.reserve(2u * nb_aabbs - 1u);
+		Build(aabbs, centroids, 0u, nb_aabbs, 0u);
+
+		m_aabbs.reserve(nb_aabbs);
+		for (const auto index : m_indices) {
+			m_aabbs.push_back(aabbs[index]);
+		}
+
+		m_cost       = ComputeCost();
+		m_build_cost = m_cost;
+	}
+
+	void BVH::Build(const AlignedVector< AABB >& aabbs,
+					const std::vector< F32x3 >& centroids,
+					U32 first,
+					U32 count,
+					std::size_t depth) {
+
+		const auto node_index = static_cast< U32 >(m_nodes.size());
+		m_nodes.emplace_back();
+
+		const auto begin = m_indices.begin() + first;
+		const auto end   = begin + count;
+
+		AABB aabb;
+		auto c_min = XMVectorReplicate(std::numeric_limits< F32 >::infinity());
+		auto c_max = -c_min;
+		for (auto it = begin; it != end; ++it) {
+			aabb = AABB::Union(aabb, aabbs[*it]);
+			const auto c = XMLoad(centroids[*it]);
+			c_min = XMVectorMin(c_min, c);
+			c_max = XMVectorMax(c_max, c);
+		}
+
+		{
+			auto& node = m_nodes[node_index];
+			node.m_aabb  = aabb;
+			node.m_first = first;
+			node.m_count = count;
+		}
+
+		if (count <= g_min_leaf_size) {
+			return;
+		}
+
+		// Select the axis with the largest centroid extent.
+		const auto extent = XMStore< F32x3 >(c_max - c_min);
+		std::size_t axis = 0u;
+		if (extent[1u] > extent[axis]) {
+			axis = 1u;
+		}
+		if (extent[2u] > extent[axis]) {
+			axis = 2u;
+		}
+
+		auto mid = begin;
+		if (0.0f < extent[axis] && depth < g_max_sah_depth) {
+			const auto c_offset = XMStore< F32x3 >(c_min)[axis];
+			const auto c_scale  = g_nb_bins / extent[axis];
+			const auto get_bin  = [&centroids, axis, c_offset, c_scale](U32 index) {
+				const auto bin = static_cast< std::size_t >(
+					(centroids[index][axis] - c_offset) * c_scale);
+				return std::min(bin, g_nb_bins - 1u);
+			};
+
+			AABB bin_aabbs[g_nb_bins];
+			U32  bin_counts[g_nb_bins] = {};
+			for (auto it = begin; it != end; ++it) {
+				const auto bin = get_bin(*it);
+				bin_aabbs[bin] = AABB::Union(bin_aabbs[bin], aabbs[*it]);
+				++bin_counts[bin];
+			}
+
+			// Sweep from the right to obtain the right-hand side areas.
+			F32 right_areas[g_nb_bins - 1u];
+			AABB right_aabb;
+			for (auto i = g_nb_bins - 1u; 0u < i; --i) {
+				right_aabb = AABB::Union(right_aabb, bin_aabbs[i]);
+				right_areas[i - 1u] = SurfaceArea(right_aabb);
+			}
+
+			// Sweep from the left to evaluate each split plane.
+			auto best_cost  = std::numeric_limits< F32 >::infinity();
+			auto best_split = g_nb_bins;
+			AABB left_aabb;
+			U32  left_count = 0u;
+			for (std::size_t i = 0u; i < g_nb_bins - 1u; ++i) {
+				left_aabb   = AABB::Union(left_aabb, bin_aabbs[i]);
+				left_count += bin_counts[i];
+
+				const auto right_count = count - left_count;
+				if (0u == left_count || 0u == right_count) {
+					continue;
+				}
+
+				const auto cost = SurfaceArea(left_aabb) * left_count
+					            + right_areas[i] * right_count;
+				if (cost < best_cost) {
+					best_cost  = cost;
+					best_split = i;
+				}
+			}
+
+			if (g_nb_bins != best_split) {
+				const auto area       = SurfaceArea(aabb);
+				const auto leaf_cost  = static_cast< F32 >(count);
+				const auto split_cost = g_traversal_cost
+					                  + (0.0f < area ? best_cost / area : 0.0f);
+				if (leaf_cost <= split_cost && count <= g_max_leaf_size) {
+					return;
+				}
+
+				mid = std::partition(begin, end,
+					[&get_bin, best_split](U32 index) {
+						return get_bin(index) <= best_split;
+					});
+			}
+		}
+
+		// Fall back to a median split for coincident centroids, degenerate
+		// partitions and deep subtrees.
+		if (mid == begin || mid == end) {
+			mid = begin + count / 2u;
+			std::nth_element(begin, mid, end,
+				[&centroids, axis](U32 lhs, U32 rhs) {
+					return centroids[lhs][axis] < centroids[rhs][axis];
+				});
+		}
+
+		const auto left_count = static_cast< U32 >(mid - begin);
+		Build(aabbs, centroids, first, left_count, depth + 1u);
+		const auto right_index = static_cast< U32 >(m_nodes.size());
+		Build(aabbs, centroids, first + left_count, count - left_count, depth + 1u);
+
+		m_nodes[node_index].m_right = right_index;
+	}
+
+	void BVH::Refit(const AlignedVector< AABB >& aabbs) {
+		for (std::size_t i = 0u; i < m_indices.size(); ++i) {
+			m_aabbs[i] = aabbs[m_indices[i]];
+		}
+
+		// Children are stored after their parent.
+		for (auto i = m_nodes.size(); 0u < i--; ) {
+			auto& node = m_nodes[i];
+
+			if (0u == node.m_right) {
+				AABB aabb;
+				const auto end = node.m_first + node.m_count;
+				for (auto j = node.m_first; j < end; ++j) {
+					aabb = AABB::Union(aabb, m_aabbs[j]);
+				}
+				node.m_aabb = aabb;
+			}
+			else {
+				node.m_aabb = AABB::Union(m_nodes[i + 1u].m_aabb,
+										  m_nodes[node.m_right].m_aabb);
+			}
+		}
+
+		m_cost = ComputeCost();
+	}
+
+	[[nodiscard]]
+	F32 BVH::ComputeCost() const noexcept {
+		if (m_nodes.empty()) {
+			return 0.0f;
+		}
+
+		const auto root_area = SurfaceArea(m_nodes.front().m_aabb);
+		if (0.0f >= root_area) {
+			return 0.0f;
+		}
+
+		F32 cost = 0.0f;
+		for (const auto& node : m_nodes) {
+			const auto area = SurfaceArea(node.m_aabb);
+			cost += (0u == node.m_right) ? area * node.m_count
+				                         : area * g_traversal_cost;
+		}
+
+		return cost / root_area;
+	}
+}
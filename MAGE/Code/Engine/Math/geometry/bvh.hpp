@@ -0,0 +1,310 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of bounding volume hierarchies (BVHs) of AABBs.
+
+	 A BVH is built top-down with the binned surface area heuristic (SAH).
+	 The nodes are stored in depth-first order: the left child of an interior
+	 node immediately follows its parent, and the primitives of each node
+	 form a contiguous range. A BVH can be refitted to moved AABBs without
+	 changing its topology.
+	 */
+	class BVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a BVH.
+		 */
+		BVH() noexcept = default;
+
+		/**
+		 Constructs a BVH from the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 */
+		BVH(const BVH& bvh) = default;
+
+		/**
+		 Constructs a BVH by moving the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 */
+		BVH(BVH&& bvh) noexcept = default;
+
+		/**
+		 Destructs this BVH.
+		 */
+		~BVH() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 @return		A reference to the copy of the given BVH (i.e. this
+						BVH).
+		 */
+		BVH& operator=(const BVH& bvh) = default;
+
+		/**
+		 Moves the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 @return		A reference to the moved BVH (i.e. this BVH).
+		 */
+		BVH& operator=(BVH&& bvh) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this BVH is empty.
+
+		 @return		@c true if this BVH is empty. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_indices.empty();
+		}
+
+		/**
+		 Returns the number of AABBs contained in this BVH.
+
+		 @return		The number of AABBs contained in this BVH.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_indices.size();
+		}
+
+		/**
+		 Returns the number of nodes of this BVH.
+
+		 @return		The number of nodes of this BVH.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfNodes() const noexcept {
+			return m_nodes.size();
+		}
+
+		/**
+		 Returns the current SAH cost of this BVH.
+
+		 @return		The current SAH cost of this BVH.
+		 */
+		[[nodiscard]]
+		F32 GetCost() const noexcept {
+			return m_cost;
+		}
+
+		/**
+		 Returns the SAH cost of this BVH right after its last build.
+
+		 Refitting degrades the quality of a BVH. The ratio of the current
+		 cost to the build cost can be used to decide when to rebuild.
+
+		 @return		The SAH cost of this BVH right after its last build.
+		 */
+		[[nodiscard]]
+		F32 GetBuildCost() const noexcept {
+			return m_build_cost;
+		}
+
+		/**
+		 Removes all AABBs from this BVH.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Builds this BVH for the given AABBs.
+
+		 @param[in]		aabbs
+						A reference to a vector containing the AABBs.
+		 */
+		void Build(const AlignedVector< AABB >& aabbs);
+
+		/**
+		 Refits this BVH to the given AABBs.
+
+		 @pre			@a aabbs contains as many AABBs as this BVH and the
+						AABBs are given in the same order as for the last
+						build.
+		 @param[in]		aabbs
+						A reference to a vector containing the AABBs.
+		 */
+		void Refit(const AlignedVector< AABB >& aabbs);
+
+		/**
+		 Calls the given action for the index of each AABB of this BVH
+		 overlapping the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type. The bounding volume must
+						support overlapping and enclosing tests with AABBs.
+		 @tparam		ActionT
+						An action to perform on the index of each overlapping
+						AABB. The action must accept @c std::size_t values.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		void ForEachOverlapping(const BoundingVolumeT& volume,
+								ActionT&& action) const;
+
+		/**
+		 Queries the AABBs of this BVH overlapping the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type. The bounding volume must
+						support overlapping and enclosing tests with AABBs.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[out]	mask
+						A reference to the visibility mask which will contain
+						a set bit for each AABB of this BVH overlapping
+						@a volume.
+		 */
+		template< typename BoundingVolumeT >
+		void Query(const BoundingVolumeT& volume, VisibilityMask& mask) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of BVH nodes.
+		 */
+		struct Node {
+
+			/**
+			 The AABB of this node.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The index of the first primitive of this node.
+			 */
+			U32 m_first = 0u;
+
+			/**
+			 The number of primitives of this node.
+			 */
+			U32 m_count = 0u;
+
+			/**
+			 The index of the right child of this node, or zero if this node
+			 is a leaf node.
+			 */
+			U32 m_right = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds the subtree of this BVH for the given range of primitives.
+
+		 @param[in]		aabbs
+						A reference to a vector containing the AABBs.
+		 @param[in]		centroids
+						A reference to a vector containing the centroids of
+						the AABBs.
+		 @param[in]		first
+						The index of the first primitive.
+		 @param[in]		count
+						The number of primitives.
+		 @param[in]		depth
+						The depth of the subtree's root node.
+		 */
+		void Build(const AlignedVector< AABB >& aabbs,
+				   const std::vector< F32x3 >& centroids,
+				   U32 first,
+				   U32 count,
+				   std::size_t depth);
+
+		/**
+		 Computes the SAH cost of this BVH.
+
+		 @return		The SAH cost of this BVH.
+		 */
+		[[nodiscard]]
+		F32 ComputeCost() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the nodes of this BVH in depth-first order.
+		 */
+		AlignedVector< Node > m_nodes;
+
+		/**
+		 A vector containing the indices of the primitives of this BVH in
+		 BVH order.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector containing the AABBs of the primitives of this BVH in BVH
+		 order.
+		 */
+		AlignedVector< AABB > m_aabbs;
+
+		/**
+		 The current SAH cost of this BVH.
+		 */
+		F32 m_cost = 0.0f;
+
+		/**
+		 The SAH cost of this BVH right after its last build.
+		 */
+		F32 m_build_cost = 0.0f;
+	};
+
+	/**
+	 A class of bounding volume hierarchies (BVHs) of AABBs.
+	 */
+	using BoundingVolumeHierarchy = BVH;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bvh.tpp"
+
+#pragma endregion
@@ -0,0 +1,63 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename BoundingVolumeT, typename ActionT >
+	void BVH::ForEachOverlapping(const BoundingVolumeT& volume,
+								 ActionT&& action) const {
+
+		if (m_nodes.empty()) {
+			return;
+		}
+
+		// The build limits the depth of the BVH to the size of this stack.
+		U32 stack[64];
+		std::size_t nb_pending = 0u;
+		U32 index = 0u;
+
+		while (true) {
+			const auto& node = m_nodes[index];
+
+			if (volume.Overlaps(node.m_aabb)) {
+				const auto end = node.m_first + node.m_count;
+
+				if (volume.Encloses(node.m_aabb)) {
+					// All primitives of this node are overlapping.
+					for (auto i = node.m_first; i < end; ++i) {
+						action(static_cast< std::size_t >(m_indices[i]));
+					}
+				}
+				else if (0u == node.m_right) {
+					for (auto i = node.m_first; i < end; ++i) {
+						if (volume.Overlaps(m_aabbs[i])) {
+							action(static_cast< std::size_t >(m_indices[i]));
+						}
+					}
+				}
+				else {
+					stack[nb_pending++] = node.m_right;
+					index = index + 1u;
+					continue;
+				}
+			}
+
+			if (0u == nb_pending) {
+				break;
+			}
+
+			index = stack[--nb_pending];
+		}
+	}
+
+	template< typename BoundingVolumeT >
+	void BVH::Query(const BoundingVolumeT& volume, VisibilityMask& mask) const {
+		mask.Reset(size());
+
+		ForEachOverlapping(volume, [&mask](std::size_t index) {
+			mask.Set(index);
+		});
+	}
+}
@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	void AABBBatch::Reserve(std::size_t capacity) {
+		m_packets.reserve((capacity + 3u) >> 2u);
+	}
+
+	void AABBBatch::Clear() noexcept {
+		m_packets.clear();
+		m_size = 0u;
+	}
+
+	std::size_t AABBBatch::Add(const AABB& aabb) {
+		const auto index = m_size++;
+		const auto lane  = index & 3u;
+
+		if (0u == lane) {
+			m_packets.emplace_back();
+		}
+
+		const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+		const auto p_max = XMStore< F32x3 >(aabb.MaxPoint());
+
+		auto& packet = m_packets.back();
+		packet.m_min_x[lane] = p_min[0];
+		packet.m_min_y[lane] = p_min[1];
+		packet.m_min_z[lane] = p_min[2];
+		packet.m_max_x[lane] = p_max[0];
+		packet.m_max_y[lane] = p_max[1];
+		packet.m_max_z[lane] = p_max[2];
+
+		return index;
+	}
+
+	void AABBBatch::Cull(const BoundingFrustum& frustum,
+						 VisibilityMask& mask) const {
+
+		mask.Reset(m_size);
+
+		XMVECTOR plane_x[6];
+		XMVECTOR plane_y[6];
+		XMVECTOR plane_z[6];
+		XMVECTOR plane_w[6];
+		XMVECTOR plane_s[6];
+		for (std::size_t i = 0u; i < std::size(plane_x); ++i) {
+			const auto plane = frustum.GetPlane(i);
+			plane_x[i] = XMVectorSplatX(plane);
+			plane_y[i] = XMVectorSplatY(plane);
+			plane_z[i] = XMVectorSplatZ(plane);
+			plane_w[i] = XMVectorSplatW(plane);
+			plane_s[i] = XMVectorGreaterOrEqual(plane, XMVectorZero());
+		}
+
+		std::size_t first = 0u;
+		for (const auto& packet : m_packets) {
+			const auto min_x = XMLoad(packet.m_min_x);
+			const auto min_y = XMLoad(packet.m_min_y);
+			const auto min_z = XMLoad(packet.m_min_z);
+			const auto max_x = XMLoad(packet.m_max_x);
+			const auto max_y = XMLoad(packet.m_max_y);
+			const auto max_z = XMLoad(packet.m_max_z);
+
+			// Test for no coverage: an AABB is culled as soon as its maximum
+			// point along the normal of a plane lies outside that plane.
+			auto culled = XMVectorFalseInt();
+			for (std::size_t i = 0u; i < std::size(plane_x); ++i) {
+				const auto control = plane_s[i];
+				const auto p_x = XMVectorSelect(min_x, max_x,
+												XMVectorSplatX(control));
+				const auto p_y = XMVectorSelect(min_y, max_y,
+												XMVectorSplatY(control));
+				const auto p_z = XMVectorSelect(min_z, max_z,
+												XMVectorSplatZ(control));
+
+				auto distance = XMVectorMultiplyAdd(p_x, plane_x[i], plane_w[i]);
+				distance      = XMVectorMultiplyAdd(p_y, plane_y[i], distance);
+				distance      = XMVectorMultiplyAdd(p_z, plane_z[i], distance);
+
+				culled = XMVectorOrInt(culled,
+									   XMVectorLess(distance, XMVectorZero()));
+			}
+
+			const auto count = std::min(std::size_t(4u), m_size - first);
+			for (std::size_t j = 0u; j < count; ++j) {
+				if (0u == XMVectorGetIntByIndex(culled, j)) {
+					mask.Set(first + j);
+				}
+			}
+
+			first += 4u;
+		}
+	}
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// VisibilityMask
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of visibility masks.
+
+	 A visibility mask contains one bit for each element of a batch of
+	 bounding volumes. A bit is set if and only if the corresponding element
+	 is visible.
+	 */
+	class VisibilityMask {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a visibility mask.
+		 */
+		VisibilityMask() noexcept = default;
+
+		/**
+		 Constructs a visibility mask from the given visibility mask.
+
+		 @param[in]		mask
+						A reference to the visibility mask to copy.
+		 */
+		VisibilityMask(const VisibilityMask& mask) = default;
+
+		/**
+		 Constructs a visibility mask by moving the given visibility mask.
+
+		 @param[in]		mask
+						A reference to the visibility mask to move.
+		 */
+		VisibilityMask(VisibilityMask&& mask) noexcept = default;
+
+		/**
+		 Destructs this visibility mask.
+		 */
+		~VisibilityMask() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given visibility mask to this visibility mask.
+
+		 @param[in]		mask
+						A reference to the visibility mask to copy.
+		 @return		A reference to the copy of the given visibility mask
+						(i.e. this visibility mask).
+		 */
+		VisibilityMask& operator=(const VisibilityMask& mask) = default;
+
+		/**
+		 Moves the given visibility mask to this visibility mask.
+
+		 @param[in]		mask
+						A reference to the visibility mask to move.
+		 @return		A reference to the moved visibility mask (i.e. this
+						visibility mask).
+		 */
+		VisibilityMask& operator=(VisibilityMask&& mask) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of elements of this visibility mask.
+
+		 @return		The number of elements of this visibility mask.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Resets this visibility mask to the given number of invisible
+		 elements.
+
+		 @param[in]		size
+						The number of elements.
+		 */
+		void Reset(std::size_t size) {
+			m_size = size;
+			m_words.assign((size + 63u) >> 6u, U64(0u));
+		}
+
+		/**
+		 Marks the element at the given index of this visibility mask as
+		 visible.
+
+		 @pre			@a index is smaller than the number of elements of
+						this visibility mask.
+		 @param[in]		index
+						The index of the element.
+		 */
+		void Set(std::size_t index) noexcept {
+			m_words[index >> 6u] |= U64(1u) << (index & 63u);
+		}
+
+		/**
+		 Checks whether the element at the given index of this visibility mask
+		 is visible.
+
+		 @pre			@a index is smaller than the number of elements of
+						this visibility mask.
+		 @param[in]		index
+						The index of the element.
+		 @return		@c true if the element at the given index is visible.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Test(std::size_t index) const noexcept {
+			return 0u != (m_words[index >> 6u] & (U64(1u) << (index & 63u)));
+		}
+
+		/**
+		 Calls the given action for the index of each visible element of this
+		 visibility mask.
+
+		 @tparam		ActionT
+						An action to perform on the index of each visible
+						element of this visibility mask. The action must
+						accept @c std::size_t values.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEach(ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The words containing the bits of this visibility mask.
+		 */
+		std::vector< U64 > m_words;
+
+		/**
+		 The number of elements of this visibility mask.
+		 */
+		std::size_t m_size = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// AABBBatch
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of AABB batches.
+
+	 The AABBs are stored as a structure of arrays in packets of four AABBs to
+	 cull four AABBs at once against the planes of a bounding frustum.
+	 */
+	class AABBBatch {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an AABB batch.
+		 */
+		AABBBatch() noexcept = default;
+
+		/**
+		 Constructs an AABB batch from the given AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to copy.
+		 */
+		AABBBatch(const AABBBatch& batch) = default;
+
+		/**
+		 Constructs an AABB batch by moving the given AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to move.
+		 */
+		AABBBatch(AABBBatch&& batch) noexcept = default;
+
+		/**
+		 Destructs this AABB batch.
+		 */
+		~AABBBatch() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given AABB batch to this AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to copy.
+		 @return		A reference to the copy of the given AABB batch (i.e.
+						this AABB batch).
+		 */
+		AABBBatch& operator=(const AABBBatch& batch) = default;
+
+		/**
+		 Moves the given AABB batch to this AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to move.
+		 @return		A reference to the moved AABB batch (i.e. this AABB
+						batch).
+		 */
+		AABBBatch& operator=(AABBBatch&& batch) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this AABB batch is empty.
+
+		 @return		@c true if this AABB batch is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_size;
+		}
+
+		/**
+		 Returns the number of AABBs contained in this AABB batch.
+
+		 @return		The number of AABBs contained in this AABB batch.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Reserves storage for the given number of AABBs.
+
+		 @param[in]		capacity
+						The number of AABBs.
+		 */
+		void Reserve(std::size_t capacity);
+
+		/**
+		 Removes all AABBs from this AABB batch.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Adds the given AABB to this AABB batch.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		The index of the given AABB in this AABB batch.
+		 */
+		std::size_t Add(const AABB& aabb);
+
+		/**
+		 Culls the AABBs of this AABB batch against the given bounding
+		 frustum.
+
+		 @param[in]		frustum
+						A reference to the bounding frustum.
+		 @param[out]	mask
+						A reference to the visibility mask which will contain
+						a set bit for each AABB of this AABB batch overlapping
+						@a frustum.
+		 */
+		void Cull(const BoundingFrustum& frustum, VisibilityMask& mask) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of AABB packets containing four AABBs as a structure of
+		 arrays.
+		 */
+		struct Packet {
+
+			/**
+			 The minimum x coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_min_x = {};
+
+			/**
+			 The minimum y coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_min_y = {};
+
+			/**
+			 The minimum z coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_min_z = {};
+
+			/**
+			 The maximum x coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_max_x = {};
+
+			/**
+			 The maximum y coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_max_y = {};
+
+			/**
+			 The maximum z coordinates of the AABBs of this packet.
+			 */
+			F32x4A m_max_z = {};
+		};
+
+		static_assert(96 == sizeof(Packet));
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the AABB packets of this AABB batch.
+		 */
+		AlignedVector< Packet > m_packets;
+
+		/**
+		 The number of AABBs contained in this AABB batch.
+		 */
+		std::size_t m_size = 0u;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\culling.tpp"
+
+#pragma endregion
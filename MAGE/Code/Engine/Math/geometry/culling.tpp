@@ -0,0 +1,22 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void VisibilityMask::ForEach(ActionT&& action) const {
+		std::size_t first = 0u;
+		for (auto word : m_words) {
+			// Stop as soon as all remaining bits of the word are cleared.
+			for (std::size_t i = first; 0u != word; ++i, word >>= 1u) {
+				if (word & U64(1u)) {
+					action(i);
+				}
+			}
+
+			first += 64u;
+		}
+	}
+}
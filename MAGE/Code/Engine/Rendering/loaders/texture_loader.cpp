@@ -44,6 +44,26 @@ namespace mage::rendering::loader {
 		}
 	}
 
+	void ImportTextureFromMemory(const std::filesystem::path& path,
+								 gsl::span< const U8 > data,
+								 ID3D11Device& device,
+								 NotNull< ID3D11ShaderResourceView** > texture_srv) {
+
+		std::wstring extension(path.extension());
+		TransformToLowerCase(extension);
+
+		if (L".dds" == extension) {
+			const HRESULT result = DirectX::CreateDDSTextureFromMemory(
+				&device, data.data(), data.size(), nullptr, texture_srv);
+			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+		}
+		else {
+			const HRESULT result = DirectX::CreateWICTextureFromMemory(
+				&device, data.data(), data.size(), nullptr, texture_srv);
+			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+		}
+	}
+
 	namespace {
 
 		/**
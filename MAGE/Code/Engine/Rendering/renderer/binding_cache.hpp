@@ -0,0 +1,161 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of binding caches.
+
+	 A binding cache shadows the values bound to a range of slots of a
+	 pipeline stage. Slots are unknown until they are bound through the
+	 binding cache or after the binding cache is invalidated.
+
+	 @tparam		T
+					The value type.
+	 @tparam		N
+					The number of slots.
+	 */
+	template< typename T, std::size_t N >
+	class BindingCache {
+
+	public:
+
+		static_assert(0u < N && N <= 64u);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a binding cache.
+		 */
+		BindingCache() noexcept = default;
+
+		/**
+		 Constructs a binding cache from the given binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to copy.
+		 */
+		BindingCache(const BindingCache& cache) noexcept = default;
+
+		/**
+		 Constructs a binding cache by moving the given binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to move.
+		 */
+		BindingCache(BindingCache&& cache) noexcept = default;
+
+		/**
+		 Destructs this binding cache.
+		 */
+		~BindingCache() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given binding cache to this binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to copy.
+		 @return		A reference to the copy of the given binding cache
+						(i.e. this binding cache).
+		 */
+		BindingCache& operator=(const BindingCache& cache) noexcept = default;
+
+		/**
+		 Moves the given binding cache to this binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to move.
+		 @return		A reference to the moved binding cache (i.e. this
+						binding cache).
+		 */
+		BindingCache& operator=(BindingCache&& cache) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Marks all slots of this binding cache as unknown.
+		 */
+		void Invalidate() noexcept {
+			m_known = 0u;
+		}
+
+		/**
+		 Updates the given range of slots of this binding cache with the given
+		 values.
+
+		 @pre			@a values points to an array containing at least
+						@a nb_values values.
+		 @tparam		U
+						The type of the given values.
+		 @param[in]		slot
+						The index of the first slot.
+		 @param[in]		nb_values
+						The number of values.
+		 @param[in]		values
+						A pointer to an array of values.
+		 @return		The index of the first slot and the number of slots
+						of the smallest range of slots which still needs to
+						be bound. The number of slots is equal to zero if all
+						values are already bound.
+		 */
+		template< typename U >
+		[[nodiscard]]
+		const std::pair< U32, U32 > Update(U32 slot,
+										   U32 nb_values,
+										   const U* values) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The values of the slots of this binding cache.
+		 */
+		T m_values[N] = {};
+
+		/**
+		 The bit mask of the known slots of this binding cache.
+		 */
+		U64 m_known = 0u;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\binding_cache.tpp"
+
+#pragma endregion
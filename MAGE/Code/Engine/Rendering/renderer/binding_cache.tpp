@@ -0,0 +1,41 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename T, std::size_t N >
+	template< typename U >
+	[[nodiscard]]
+	inline const std::pair< U32, U32 > BindingCache< T, N >
+		::Update(U32 slot, U32 nb_values, const U* values) noexcept {
+
+		if (N < static_cast< std::size_t >(slot) + nb_values) {
+			// Forget the cached slots overlapping the uncached range.
+			for (auto i = static_cast< std::size_t >(slot); i < N; ++i) {
+				m_known &= ~(U64(1u) << i);
+			}
+
+			return { slot, nb_values };
+		}
+
+		U32 first = nb_values;
+		U32 end   = 0u;
+		for (U32 i = 0u; i < nb_values; ++i) {
+			const auto index = slot + i;
+			const auto mask  = U64(1u) << index;
+			const auto value = static_cast< T >(values[i]);
+
+			if (0u == (m_known & mask) || value != m_values[index]) {
+				m_values[index] = value;
+				m_known        |= mask;
+				first           = std::min(first, i);
+				end             = i + 1u;
+			}
+		}
+
+		return (first < end) ? std::make_pair(slot + first, end - first)
+			                 : std::make_pair(slot, 0u);
+	}
+}
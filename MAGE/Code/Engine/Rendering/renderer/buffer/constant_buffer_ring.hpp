@@ -0,0 +1,362 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\buffer_lock.hpp"
+#include "renderer\buffer\ring_allocator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of constant buffer ranges.
+	 */
+	struct ConstantBufferRange {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset of this constant buffer range in shader constants (i.e.
+		 16 bytes).
+		 */
+		U32 m_first_constant = 0u;
+
+		/**
+		 The number of shader constants of this constant buffer range.
+		 */
+		U32 m_nb_constants = 0u;
+	};
+
+	/**
+	 A class of constant buffer rings.
+
+	 A constant buffer ring sub-allocates the data of all draws of a frame
+	 from a single dynamic constant buffer, which is mapped once per frame.
+	 Each data element occupies a range aligned to 256 bytes, which is bound
+	 with a constant buffer offset. The data elements of a frame remain valid
+	 till the GPU finished that frame: each frame is fenced with an event
+	 query, and the ranges of a frame are only reused after waiting for its
+	 query. The CPU can therefore be at most @c s_nb_frames - 1 frames ahead
+	 of the GPU.
+
+	 Devices which do not support constant buffer offsetting (e.g. feature
+	 level 11_0 devices) cannot use a constant buffer ring. Users must check
+	 @c SupportsOffsetting and fall back to a constant buffer per data
+	 element otherwise.
+
+	 @tparam		T
+					The data type.
+	 */
+	template< typename T >
+	class ConstantBufferRing {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of frames in flight, including the frame recorded
+		 by the CPU.
+		 */
+		static constexpr std::size_t s_nb_frames = 4u;
+
+		/**
+		 The stride in bytes of the data elements of constant buffer rings.
+		 */
+		static constexpr std::size_t s_stride = (sizeof(T) + 255u) & ~std::size_t(255u);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant buffer ring.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		nb_data_elements
+						The initial number of data elements per frame.
+		 @throws		Exception
+						Failed to setup this constant buffer ring on a device
+						supporting constant buffer offsetting.
+		 */
+		explicit ConstantBufferRing(ID3D11Device& device,
+									ID3D11DeviceContext& device_context,
+									std::size_t nb_data_elements = 1024u);
+
+		/**
+		 Constructs a constant buffer ring from the given constant buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to copy.
+		 */
+		ConstantBufferRing(const ConstantBufferRing& ring) = delete;
+
+		/**
+		 Constructs a constant buffer ring by moving the given constant buffer
+		 ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to move.
+		 */
+		ConstantBufferRing(ConstantBufferRing&& ring) noexcept = default;
+
+		/**
+		 Destructs this constant buffer ring.
+		 */
+		~ConstantBufferRing() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given constant buffer ring to this constant buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to copy.
+		 @return		A reference to the copy of the given constant buffer
+						ring (i.e. this constant buffer ring).
+		 */
+		ConstantBufferRing& operator=(const ConstantBufferRing& ring) = delete;
+
+		/**
+		 Moves the given constant buffer ring to this constant buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to move.
+		 @return		A reference to the moved constant buffer ring (i.e.
+						this constant buffer ring).
+		 */
+		ConstantBufferRing& operator=(ConstantBufferRing&& ring) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the device of this constant buffer ring supports
+		 constant buffer offsetting.
+
+		 @return		@c true if the device of this constant buffer ring
+						supports constant buffer offsetting. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool SupportsOffsetting() const noexcept {
+			return nullptr != m_device_context1;
+		}
+
+		/**
+		 Returns the device context of this constant buffer ring.
+
+		 @return		A reference to the device context of this constant
+						buffer ring.
+		 */
+		[[nodiscard]]
+		ID3D11DeviceContext& GetDeviceContext() const noexcept {
+			return *m_device_context.Get();
+		}
+
+		/**
+		 Begins a new frame of this constant buffer ring and maps its buffer.
+		 Waits for the GPU if the frame whose ranges are reused is still in
+		 flight.
+
+		 This is a no-op if this constant buffer ring does not support
+		 constant buffer offsetting.
+
+		 @pre			All GPU commands of the previous frame are submitted.
+		 @param[in]		nb_data_elements
+						The number of data elements of the frame.
+		 @throws		Exception
+						Failed to grow or map the buffer.
+		 */
+		void BeginFrame(std::size_t nb_data_elements);
+
+		/**
+		 Ends the current frame of this constant buffer ring and unmaps its
+		 buffer.
+
+		 This is a no-op if this constant buffer ring does not support
+		 constant buffer offsetting.
+		 */
+		void EndFrame() noexcept;
+
+		/**
+		 Allocates a range of this constant buffer ring for the given data.
+
+		 @pre			This constant buffer ring supports constant buffer
+						offsetting.
+		 @pre			This constant buffer ring is mapped and has not yet
+						allocated the number of data elements announced at the
+						beginning of the current frame.
+		 @param[in]		data
+						A reference to the data.
+		 @return		The constant buffer range containing @a data.
+		 */
+		[[nodiscard]]
+		const ConstantBufferRange Allocate(const T& data) noexcept;
+
+		/**
+		 Returns the buffer resource of this constant buffer ring.
+
+		 @return		A reference to the buffer resource of this constant
+						buffer ring.
+		 */
+		[[nodiscard]]
+		ID3D11Buffer& Get() const noexcept {
+			return *m_buffer.Get();
+		}
+
+		/**
+		 Binds the given range of this constant buffer ring.
+
+		 @pre			This constant buffer ring supports constant buffer
+						offsetting.
+		 @pre			@a slot <
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set the
+						constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+						- 1).
+		 @param[in]		range
+						A reference to the constant buffer range.
+		 */
+		template< typename PipelineStageT >
+		void Bind(U32 slot, const ConstantBufferRange& range) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the resource buffer of this constant buffer ring.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		nb_data_elements
+						The number of data elements per frame.
+		 @throws		Exception
+						Failed to setup the resource buffer.
+		 */
+		void SetupConstantBuffer(ID3D11Device& device,
+								 std::size_t nb_data_elements);
+
+		/**
+		 Sets up the event queries of this constant buffer ring.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @throws		Exception
+						Failed to setup the event queries.
+		 */
+		void SetupQueries(ID3D11Device& device);
+
+		/**
+		 Waits till the GPU finished the frame of this constant buffer ring
+		 with the given index, if that frame is fenced.
+
+		 @param[in]		frame
+						The frame index.
+		 */
+		void WaitForFrame(U64 frame) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the device context of this constant buffer ring.
+		 */
+		ComPtr< ID3D11DeviceContext > m_device_context;
+
+		/**
+		 A pointer to the device context of this constant buffer ring, if
+		 the device supports constant buffer offsetting.
+		 */
+		ComPtr< ID3D11DeviceContext1 > m_device_context1;
+
+		/**
+		 A pointer to the buffer resource of this constant buffer ring.
+		 */
+		ComPtr< ID3D11Buffer > m_buffer;
+
+		/**
+		 The ring allocator of this constant buffer ring.
+		 */
+		RingAllocator m_allocator;
+
+		/**
+		 An array containing the event queries fencing the frames in flight
+		 of this constant buffer ring, indexed by frame index modulo the
+		 number of frames in flight.
+		 */
+		std::array< ComPtr< ID3D11Query >, s_nb_frames > m_queries;
+
+		/**
+		 An array containing flags indicating whether the event query of
+		 each frame in flight of this constant buffer ring is issued.
+		 */
+		std::array< bool, s_nb_frames > m_fenced;
+
+		/**
+		 The index of the current frame of this constant buffer ring.
+		 */
+		U64 m_frame;
+
+		/**
+		 The buffer lock of this constant buffer ring while mapped.
+		 */
+		std::optional< BufferLock > m_lock;
+
+		/**
+		 A pointer to the mapped data of this constant buffer ring.
+		 */
+		U8* m_data;
+
+		/**
+		 A flag indicating whether the buffer resource of this constant
+		 buffer ring has not been mapped yet.
+		 */
+		bool m_discard;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\constant_buffer_ring.tpp"
+
+#pragma endregion
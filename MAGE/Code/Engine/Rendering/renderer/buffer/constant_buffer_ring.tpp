@@ -0,0 +1,200 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\factory.hpp"
+#include "logging\logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename T >
+	ConstantBufferRing< T >::ConstantBufferRing(ID3D11Device& device,
+												ID3D11DeviceContext& device_context,
+												std::size_t nb_data_elements)
+		: m_device_context(&device_context),
+		m_device_context1(),
+		m_buffer(),
+		m_allocator(),
+		m_queries(),
+		m_fenced(),
+		m_frame(0u),
+		m_lock(),
+		m_data(nullptr),
+		m_discard(true) {
+
+		{
+			D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+			const HRESULT result
+				= device.CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS,
+											 &options, sizeof(options));
+			if (FAILED(result)
+				|| !options.ConstantBufferOffsetting
+				|| !options.MapNoOverwriteOnDynamicConstantBuffer) {
+
+				// Users fall back to a constant buffer per data element.
+				Warning("Constant buffer offsetting is not supported.");
+				return;
+			}
+		}
+		{
+			// Get the ID3D11DeviceContext1.
+			const HRESULT result = m_device_context.As(&m_device_context1);
+			ThrowIfFailed(result,
+						  "ID3D11DeviceContext1 creation failed: {:08X}.", result);
+		}
+
+		SetupConstantBuffer(device, nb_data_elements);
+		SetupQueries(device);
+	}
+
+	template< typename T >
+	void ConstantBufferRing< T >
+		::SetupConstantBuffer(ID3D11Device& device,
+							  std::size_t nb_data_elements) {
+
+		const auto capacity = s_nb_frames * s_stride
+			                * std::max(nb_data_elements, std::size_t(1u));
+
+		const HRESULT result = CreateDynamicConstantBuffer< U8 >(
+			device, NotNull< ID3D11Buffer** >(m_buffer.ReleaseAndGetAddressOf()),
+			capacity);
+		ThrowIfFailed(result, "Constant buffer creation failed: {:08X}.", result);
+
+		// The previous buffer stays alive till the GPU no longer uses it.
+		m_allocator = RingAllocator(capacity, s_stride, s_nb_frames);
+		m_discard   = true;
+	}
+
+	template< typename T >
+	void ConstantBufferRing< T >::SetupQueries(ID3D11Device& device) {
+		D3D11_QUERY_DESC desc = {};
+		desc.Query = D3D11_QUERY_EVENT;
+
+		for (auto& query : m_queries) {
+			const HRESULT result
+				= device.CreateQuery(&desc, query.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Query creation failed: {:08X}.", result);
+		}
+	}
+
+	template< typename T >
+	void ConstantBufferRing< T >::WaitForFrame(U64 frame) noexcept {
+		const auto index = static_cast< std::size_t >(frame % s_nb_frames);
+		if (!m_fenced[index]) {
+			return;
+		}
+
+		// GetData flushes the command buffer unless
+		// D3D11_ASYNC_GETDATA_DONOTFLUSH is passed, so the query eventually
+		// completes.
+		while (S_FALSE == m_device_context->GetData(m_queries[index].Get(),
+													nullptr, 0u, 0u)) {
+			std::this_thread::yield();
+		}
+
+		m_fenced[index] = false;
+	}
+
+	template< typename T >
+	void ConstantBufferRing< T >::BeginFrame(std::size_t nb_data_elements) {
+		if (!SupportsOffsetting()) {
+			return;
+		}
+
+		Assert(!m_lock);
+
+		// Fence the previous frame, whose GPU commands are all submitted.
+		if (0u != m_frame) {
+			const auto index = static_cast< std::size_t >((m_frame - 1u) % s_nb_frames);
+			m_device_context->End(m_queries[index].Get());
+			m_fenced[index] = true;
+		}
+
+		// Wait till the frame whose ranges are released is no longer in
+		// flight.
+		WaitForFrame(m_frame);
+
+		m_allocator.BeginFrame();
+
+		// Each data element occupies exactly one stride and the capacity is
+		// a multiple of the stride, so the ring never skips bytes.
+		if (m_allocator.GetFreeSize() < nb_data_elements * s_stride) {
+			ComPtr< ID3D11Device > device;
+			m_device_context->GetDevice(device.ReleaseAndGetAddressOf());
+
+			const auto capacity = m_allocator.GetCapacity() / s_stride;
+			SetupConstantBuffer(*device.Get(),
+								std::max(nb_data_elements, capacity / s_nb_frames * 2u));
+			m_allocator.BeginFrame();
+		}
+
+		const auto map_type = m_discard ? D3D11_MAP_WRITE_DISCARD
+			                            : D3D11_MAP_WRITE_NO_OVERWRITE;
+		m_discard = false;
+
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		m_lock.emplace(*m_device_context.Get(), *m_buffer.Get(),
+					   map_type, mapped_buffer);
+		m_data = static_cast< U8* >(mapped_buffer.pData);
+	}
+
+	template< typename T >
+	void ConstantBufferRing< T >::EndFrame() noexcept {
+		if (!SupportsOffsetting()) {
+			return;
+		}
+
+		m_lock.reset();
+		m_data = nullptr;
+
+		m_allocator.EndFrame();
+		++m_frame;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	const ConstantBufferRange ConstantBufferRing< T >
+		::Allocate(const T& data) noexcept {
+
+		Assert(m_data);
+
+		const auto offset = m_allocator.Allocate(s_stride);
+		Assert(offset);
+
+		memcpy(m_data + *offset, &data, sizeof(T));
+
+		return {
+			static_cast< U32 >(*offset / 16u),
+			static_cast< U32 >(s_stride / 16u)
+		};
+	}
+
+	template< typename T >
+	template< typename PipelineStageT >
+	inline void ConstantBufferRing< T >
+		::Bind(U32 slot, const ConstantBufferRange& range) const noexcept {
+
+		PipelineStageT::BindConstantBuffer(*m_device_context1.Get(), slot,
+										   m_buffer.Get(),
+										   range.m_first_constant,
+										   range.m_nb_constants);
+	}
+}
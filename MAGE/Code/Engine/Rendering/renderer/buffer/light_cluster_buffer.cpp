@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\light_cluster_buffer.hpp"
+#include "exception\exception.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		void SetupStructuredBuffer(ID3D11Device& device,
+								   std::size_t nb_elements,
+								   std::size_t stride,
+								   NotNull< ID3D11Buffer** > buffer,
+								   NotNull< ID3D11ShaderResourceView** > srv,
+								   NotNull< ID3D11UnorderedAccessView** > uav) {
+
+			// Create the structured buffer.
+			{
+				// Create the buffer descriptor.
+				D3D11_BUFFER_DESC buffer_desc = {};
+				buffer_desc.BindFlags           = D3D11_BIND_SHADER_RESOURCE
+												| D3D11_BIND_UNORDERED_ACCESS;
+				buffer_desc.MiscFlags           = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+				buffer_desc.ByteWidth           = static_cast< U32 >(stride * nb_elements);
+				buffer_desc.StructureByteStride = static_cast< U32 >(stride);
+				// GPU:    read +    write
+				// CPU: no read + no write
+				buffer_desc.Usage               = D3D11_USAGE_DEFAULT;
+
+				const HRESULT result = device.CreateBuffer(
+					&buffer_desc, nullptr, buffer);
+				ThrowIfFailed(result, "Structured buffer creation failed: {:08X}.", result);
+			}
+
+			// Create the SRV.
+			{
+				// Create the SRV descriptor.
+				D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc = {};
+				srv_desc.Format              = DXGI_FORMAT_UNKNOWN;
+				srv_desc.ViewDimension       = D3D11_SRV_DIMENSION_BUFFER;
+				srv_desc.Buffer.FirstElement = 0u;
+				srv_desc.Buffer.NumElements  = static_cast< U32 >(nb_elements);
+
+				const HRESULT result = device.CreateShaderResourceView(
+					*buffer, &srv_desc, srv);
+				ThrowIfFailed(result, "SRV creation failed: {:08X}.", result);
+			}
+
+			// Create the UAV.
+			{
+				// Create the UAV descriptor.
+				D3D11_UNORDERED_ACCESS_VIEW_DESC uav_desc = {};
+				uav_desc.Format              = DXGI_FORMAT_UNKNOWN;
+				uav_desc.ViewDimension       = D3D11_UAV_DIMENSION_BUFFER;
+				uav_desc.Buffer.FirstElement = 0u;
+				uav_desc.Buffer.NumElements  = static_cast< U32 >(nb_elements);
+
+				const HRESULT result = device.CreateUnorderedAccessView(
+					*buffer, &uav_desc, uav);
+				ThrowIfFailed(result, "UAV creation failed: {:08X}.", result);
+			}
+		}
+	}
+
+	LightClusterBuffer::LightClusterBuffer(ID3D11Device& device)
+		: m_clusters(),
+		m_clusters_srv(),
+		m_clusters_uav(),
+		m_indices(),
+		m_indices_srv(),
+		m_indices_uav() {
+
+		SetupStructuredBuffer(device,
+							  LIGHT_CLUSTER_COUNT,
+							  sizeof(U32x4),
+							  m_clusters.ReleaseAndGetAddressOf(),
+							  m_clusters_srv.ReleaseAndGetAddressOf(),
+							  m_clusters_uav.ReleaseAndGetAddressOf());
+		SetupStructuredBuffer(device,
+							  LIGHT_CLUSTER_COUNT * LIGHT_CLUSTER_MAX_LIGHTS,
+							  sizeof(U32),
+							  m_indices.ReleaseAndGetAddressOf(),
+							  m_indices_srv.ReleaseAndGetAddressOf(),
+							  m_indices_uav.ReleaseAndGetAddressOf());
+	}
+
+	LightClusterBuffer::LightClusterBuffer(
+		LightClusterBuffer&& buffer) noexcept = default;
+
+	LightClusterBuffer::~LightClusterBuffer() = default;
+
+	LightClusterBuffer& LightClusterBuffer
+		::operator=(LightClusterBuffer&& buffer) noexcept = default;
+
+	void LightClusterBuffer::UpdateData(ID3D11DeviceContext& device_context,
+										const AlignedVector< U32x4 >& clusters,
+										const AlignedVector< U32 >& indices) const noexcept {
+
+		device_context.UpdateSubresource(m_clusters.Get(), 0u, nullptr,
+										 clusters.data(), 0u, 0u);
+
+		if (indices.empty()) {
+			return;
+		}
+
+		// Only update the used part of the light index list.
+		D3D11_BOX box = {};
+		box.right  = static_cast< U32 >(sizeof(U32) * indices.size());
+		box.bottom = 1u;
+		box.back   = 1u;
+		device_context.UpdateSubresource(m_indices.Get(), 0u, &box,
+										 indices.data(), 0u, 0u);
+	}
+
+	void LightClusterBuffer::BindBeginClustering(
+		ID3D11DeviceContext& device_context) const noexcept {
+
+		// Unbind the SRVs.
+		Pipeline::PS::BindSRV(device_context, SLOT_SRV_LIGHT_CLUSTERS,
+							  nullptr);
+		Pipeline::PS::BindSRV(device_context, SLOT_SRV_LIGHT_INDEX_LIST,
+							  nullptr);
+		Pipeline::CS::BindSRV(device_context, SLOT_SRV_LIGHT_CLUSTERS,
+							  nullptr);
+		Pipeline::CS::BindSRV(device_context, SLOT_SRV_LIGHT_INDEX_LIST,
+							  nullptr);
+
+		// Bind the UAVs.
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_LIGHT_CLUSTERS,
+							  m_clusters_uav.Get());
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_LIGHT_INDEX_LIST,
+							  m_indices_uav.Get());
+	}
+
+	void LightClusterBuffer::BindEndClustering(
+		ID3D11DeviceContext& device_context) const noexcept {
+
+		// Unbind the UAVs.
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_LIGHT_CLUSTERS,
+							  nullptr);
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_LIGHT_INDEX_LIST,
+							  nullptr);
+	}
+}
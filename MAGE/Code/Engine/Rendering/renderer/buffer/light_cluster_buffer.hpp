@@ -0,0 +1,107 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\pipeline.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of light cluster buffers.
+
+	 A light cluster buffer contains a light cluster (i.e. an offset into the
+	 light index list, a number of omni lights and a number of spotlights)
+	 for each light cluster of the light cluster grid, and the light index
+	 list. Both can be written on the CPU or by a compute shader.
+	 */
+	class LightClusterBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a light cluster buffer.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @throws		Exception
+						Failed to setup this light cluster buffer.
+		 */
+		explicit LightClusterBuffer(ID3D11Device& device);
+		LightClusterBuffer(const LightClusterBuffer& buffer) = delete;
+		LightClusterBuffer(LightClusterBuffer&& buffer) noexcept;
+		~LightClusterBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		LightClusterBuffer& operator=(const LightClusterBuffer& buffer) = delete;
+		LightClusterBuffer& operator=(LightClusterBuffer&& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the data of this light cluster buffer with the given data.
+
+		 @pre			@a clusters contains a light cluster for each light
+						cluster of the light cluster grid.
+		 @pre			@a indices does not contain more light indices than
+						the light cluster grid can reference.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		clusters
+						A reference to a vector containing the light
+						clusters.
+		 @param[in]		indices
+						A reference to a vector containing the light
+						indices.
+		 */
+		void UpdateData(ID3D11DeviceContext& device_context,
+						const AlignedVector< U32x4 >& clusters,
+						const AlignedVector< U32 >& indices) const noexcept;
+
+		void BindBeginClustering(
+			ID3D11DeviceContext& device_context) const noexcept;
+		void BindEndClustering(
+			ID3D11DeviceContext& device_context) const noexcept;
+
+		[[nodiscard]]
+		ID3D11ShaderResourceView& GetClustersSRV() const noexcept {
+			return *m_clusters_srv.Get();
+		}
+
+		[[nodiscard]]
+		ID3D11ShaderResourceView& GetIndicesSRV() const noexcept {
+			return *m_indices_srv.Get();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		ComPtr< ID3D11Buffer > m_clusters;
+		ComPtr< ID3D11ShaderResourceView > m_clusters_srv;
+		ComPtr< ID3D11UnorderedAccessView > m_clusters_uav;
+
+		ComPtr< ID3D11Buffer > m_indices;
+		ComPtr< ID3D11ShaderResourceView > m_indices_srv;
+		ComPtr< ID3D11UnorderedAccessView > m_indices_uav;
+	};
+}
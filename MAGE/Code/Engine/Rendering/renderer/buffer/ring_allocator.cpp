@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\ring_allocator.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	RingAllocator::RingAllocator(std::size_t capacity,
+								 std::size_t alignment,
+								 std::size_t nb_frames)
+		: m_capacity(capacity),
+		m_alignment(alignment),
+		m_head(0u),
+		m_tail(0u),
+		m_frame(0u),
+		m_frame_heads(nb_frames, 0u) {
+
+		Assert(0u != alignment && 0u == (alignment & (alignment - 1u)));
+		Assert(0u == capacity % alignment);
+		Assert(0u != nb_frames);
+	}
+
+	void RingAllocator::BeginFrame() noexcept {
+		// The head at the end of the frame which is no longer in flight.
+		const auto index = m_frame % m_frame_heads.size();
+		m_tail = std::max(m_tail, m_frame_heads[index]);
+	}
+
+	void RingAllocator::EndFrame() noexcept {
+		const auto index = m_frame % m_frame_heads.size();
+		m_frame_heads[index] = m_head;
+		++m_frame;
+	}
+
+	[[nodiscard]]
+	const std::optional< std::size_t >
+		RingAllocator::Allocate(std::size_t size) noexcept {
+
+		const auto aligned_size = (size + m_alignment - 1u) & ~(m_alignment - 1u);
+		if (0u == m_capacity || m_capacity < aligned_size) {
+			return {};
+		}
+
+		auto offset  = static_cast< std::size_t >(m_head % m_capacity);
+		auto padding = std::size_t(0u);
+		if (m_capacity < offset + aligned_size) {
+			// Skip the bytes till the end of the region.
+			padding = m_capacity - offset;
+			offset  = 0u;
+		}
+
+		if (GetFreeSize() < padding + aligned_size) {
+			return {};
+		}
+
+		m_head += padding + aligned_size;
+		return offset;
+	}
+
+	void RingAllocator::Reset() noexcept {
+		m_head = 0u;
+		m_tail = 0u;
+		std::fill(m_frame_heads.begin(), m_frame_heads.end(), U64(0u));
+	}
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of ring allocators.
+
+	 A ring allocator sub-allocates aligned ranges from a fixed-size region
+	 in allocation order, wrapping around at the end of the region. The
+	 ranges allocated during a frame are released once that frame can no
+	 longer be in flight, i.e. at the start of the frame which comes the given
+	 number of frames in flight later.
+	 */
+	class RingAllocator {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a ring allocator.
+
+		 @pre			@a alignment is a power of two.
+		 @pre			@a capacity is a multiple of @a alignment.
+		 @pre			@a nb_frames is greater than zero.
+		 @param[in]		capacity
+						The capacity in bytes.
+		 @param[in]		alignment
+						The alignment in bytes of all allocations.
+		 @param[in]		nb_frames
+						The maximum number of frames in flight, including the
+						frame recorded by the CPU.
+		 */
+		explicit RingAllocator(std::size_t capacity = 0u,
+							   std::size_t alignment = 256u,
+							   std::size_t nb_frames = 4u);
+
+		/**
+		 Constructs a ring allocator from the given ring allocator.
+
+		 @param[in]		allocator
+						A reference to the ring allocator to copy.
+		 */
+		RingAllocator(const RingAllocator& allocator) = default;
+
+		/**
+		 Constructs a ring allocator by moving the given ring allocator.
+
+		 @param[in]		allocator
+						A reference to the ring allocator to move.
+		 */
+		RingAllocator(RingAllocator&& allocator) noexcept = default;
+
+		/**
+		 Destructs this ring allocator.
+		 */
+		~RingAllocator() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given ring allocator to this ring allocator.
+
+		 @param[in]		allocator
+						A reference to the ring allocator to copy.
+		 @return		A reference to the copy of the given ring allocator
+						(i.e. this ring allocator).
+		 */
+		RingAllocator& operator=(const RingAllocator& allocator) = default;
+
+		/**
+		 Moves the given ring allocator to this ring allocator.
+
+		 @param[in]		allocator
+						A reference to the ring allocator to move.
+		 @return		A reference to the moved ring allocator (i.e. this ring
+						allocator).
+		 */
+		RingAllocator& operator=(RingAllocator&& allocator) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the capacity of this ring allocator.
+
+		 @return		The capacity in bytes of this ring allocator.
+		 */
+		[[nodiscard]]
+		std::size_t GetCapacity() const noexcept {
+			return m_capacity;
+		}
+
+		/**
+		 Returns the alignment of this ring allocator.
+
+		 @return		The alignment in bytes of all allocations of this ring
+						allocator.
+		 */
+		[[nodiscard]]
+		std::size_t GetAlignment() const noexcept {
+			return m_alignment;
+		}
+
+		/**
+		 Returns the number of allocated bytes of this ring allocator which
+		 are not released yet.
+
+		 @return		The number of allocated bytes of this ring allocator
+						which are not released yet.
+		 */
+		[[nodiscard]]
+		std::size_t GetUsedSize() const noexcept {
+			return static_cast< std::size_t >(m_head - m_tail);
+		}
+
+		/**
+		 Returns the number of bytes of this ring allocator which are
+		 available for allocation.
+
+		 @return		The number of bytes of this ring allocator which are
+						available for allocation.
+		 */
+		[[nodiscard]]
+		std::size_t GetFreeSize() const noexcept {
+			return m_capacity - GetUsedSize();
+		}
+
+		/**
+		 Returns the index of the current frame of this ring allocator.
+
+		 @return		The index of the current frame of this ring allocator.
+		 */
+		[[nodiscard]]
+		U64 GetFrame() const noexcept {
+			return m_frame;
+		}
+
+		/**
+		 Begins a new frame of this ring allocator. All ranges allocated
+		 during the frame which can no longer be in flight are released.
+		 */
+		void BeginFrame() noexcept;
+
+		/**
+		 Ends the current frame of this ring allocator.
+		 */
+		void EndFrame() noexcept;
+
+		/**
+		 Allocates a range of the given size.
+
+		 A range never wraps around the end of the region of this ring
+		 allocator. The bytes between the last range and the end of the
+		 region are skipped instead.
+
+		 @param[in]		size
+						The size in bytes.
+		 @return		The offset in bytes of the allocated range, if this
+						ring allocator has sufficient free space. Nothing
+						otherwise.
+		 */
+		[[nodiscard]]
+		const std::optional< std::size_t > Allocate(std::size_t size) noexcept;
+
+		/**
+		 Releases all ranges of this ring allocator.
+		 */
+		void Reset() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The capacity in bytes of this ring allocator.
+		 */
+		std::size_t m_capacity;
+
+		/**
+		 The alignment in bytes of all allocations of this ring allocator.
+		 */
+		std::size_t m_alignment;
+
+		/**
+		 The total number of bytes ever allocated by this ring allocator. The
+		 head of this ring allocator is located at this value modulo the
+		 capacity.
+		 */
+		U64 m_head;
+
+		/**
+		 The total number of bytes ever released by this ring allocator. The
+		 tail of this ring allocator is located at this value modulo the
+		 capacity.
+		 */
+		U64 m_tail;
+
+		/**
+		 The index of the current frame of this ring allocator.
+		 */
+		U64 m_frame;
+
+		/**
+		 A vector containing the head of this ring allocator at the end of
+		 each frame in flight, indexed by frame index modulo the number of
+		 frames in flight.
+		 */
+		std::vector< U64 > m_frame_heads;
+	};
+}
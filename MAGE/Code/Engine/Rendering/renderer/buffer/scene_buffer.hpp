@@ -8,6 +8,9 @@
 #include "geometry\geometry.hpp"
 #include "spectrum\spectrum.hpp"
 
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -272,9 +275,29 @@ namespace mage::rendering {
 		 The padding of this light buffer.
 		 */
 		F32 m_padding2 = {};
+
+		//---------------------------------------------------------------------
+		// Member Variables: Light Clusters
+		//---------------------------------------------------------------------
+
+		/**
+		 The scale and bias converting the base-2 logarithm of a camera space
+		 depth to a light cluster slice of this light buffer.
+		 */
+		F32x2 m_light_cluster_depth;
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding3 = {};
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding4 = {};
 	};
 
-	static_assert(48u == sizeof(LightBuffer),
+	static_assert(64u == sizeof(LightBuffer),
 				  "CPU/GPU struct mismatch");
 
 	/**
@@ -448,6 +471,30 @@ namespace mage::rendering {
 	static_assert(112u == sizeof(ShadowMappedOmniLightBuffer),
 				  "CPU/GPU struct mismatch");
 
+	/**
+	 A struct of shadow mapped directional light buffers used by shaders.
+	 */
+	struct alignas(16) ShadowMappedDirectionalLightBuffer
+		: public DirectionalLightBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables: Transform
+		//---------------------------------------------------------------------
+
+		/**
+		 The (column-major packed, row-major matrix) world-to-projection
+		 matrices of the shadow cascades of the shadow mapped directional
+		 light of this shadow mapped directional light buffer.
+		 */
+		XMMATRIX m_cascade_world_to_projections[SHADOW_CASCADE_COUNT] = {};
+	};
+
+	static_assert(96u + 64u * SHADOW_CASCADE_COUNT
+				  == sizeof(ShadowMappedDirectionalLightBuffer),
+				  "CPU/GPU struct mismatch");
+
 	/**
 	 A struct of shadow mapped spotlight buffers used by shaders.
 	 */
@@ -465,9 +512,16 @@ namespace mage::rendering {
 		 buffer.
 		 */
 		XMMATRIX m_world_to_projection = {};
+
+		/**
+		 The shadow atlas tile [offset.u, offset.v, scale, unused] expressed
+		 in UV space of the shadow atlas of the shadow mapped spotlight of
+		 this shadow mapped spotlight buffer.
+		 */
+		F32x4 m_shadow_tile = {};
 	};
 
-	static_assert(112u == sizeof(ShadowMappedSpotLightBuffer),
+	static_assert(128u == sizeof(ShadowMappedSpotLightBuffer),
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
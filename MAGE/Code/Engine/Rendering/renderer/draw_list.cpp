@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\draw_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Folds the given hash value to the given number of bits.
+
+		 @param[in]		hash
+						The hash value.
+		 @param[in]		nb_bits
+						The number of bits.
+		 @return		The given hash value folded to @a nb_bits bits.
+		 */
+		[[nodiscard]]
+		U64 Fold(U64 hash, U32 nb_bits) noexcept {
+			// Mix the higher bits into the lower bits (SplitMix64 finalizer).
+			hash ^= hash >> 30u;
+			hash *= 0xBF58476D1CE4E5B9ull;
+			hash ^= hash >> 27u;
+			hash *= 0x94D049BB133111EBull;
+			hash ^= hash >> 31u;
+			return hash & ((U64(1u) << nb_bits) - 1u);
+		}
+
+		/**
+		 Returns the hash value of the given pointer.
+
+		 @param[in]		ptr
+						A pointer.
+		 @return		The hash value of @a ptr.
+		 */
+		[[nodiscard]]
+		U64 Hash(const void* ptr) noexcept {
+			return static_cast< U64 >(std::hash< const void* >()(ptr));
+		}
+
+		/**
+		 Returns the 16-bit quantized view depth of the given view depth.
+
+		 The upper bits of a non-negative IEEE-754 single precision
+		 floating point value are monotonic in that value, resulting in a
+		 logarithmic quantization.
+
+		 @param[in]		depth
+						The view depth.
+		 @return		The 16-bit quantized view depth of @a depth.
+		 */
+		[[nodiscard]]
+		U64 QuantizeDepth(F32 depth) noexcept {
+			const auto clamped_depth = std::max(depth, 0.0f);
+			U32 bits;
+			std::memcpy(&bits, &clamped_depth, sizeof(bits));
+			return static_cast< U64 >(bits >> 16u);
+		}
+	}
+
+	[[nodiscard]]
+	U64 DrawList::GetKey(U64 state_key, F32 depth, DrawOrder order) noexcept {
+		const auto depth_id = QuantizeDepth(depth);
+
+		switch (order) {
+
+		case DrawOrder::BackToFront:
+			// [63-48] inverted depth | [47-28] mesh | [27-0] textures
+			return ((0xFFFFu - depth_id) << 48u)
+				 | state_key;
+
+		default:
+			// [63-44] mesh | [43-16] textures | [15-0] depth
+			return (state_key << 16u)
+				 | depth_id;
+		}
+	}
+
+	[[nodiscard]]
+	U64 DrawList::GetStateKey(const Model& model) noexcept {
+		const auto& material = model.GetMaterial();
+
+		const auto mesh_id     = Fold(Hash(model.GetMesh()), 20u);
+		const auto textures_id = Fold(Hash(material.GetBaseColorSRV())
+									  ^ (Hash(material.GetMaterialSRV()) << 1u)
+									  ^ (Hash(material.GetNormalSRV())   << 2u),
+									  28u);
+
+		// [47-28] mesh | [27-0] textures
+		return (mesh_id << 28u) | textures_id;
+	}
+
+	[[nodiscard]]
+	bool DrawList::SharesTextures(const Model& model,
+								  const Model* previous) noexcept {
+		if (!previous) {
+			return false;
+		}
+
+		const auto& material          = model.GetMaterial();
+		const auto& previous_material = previous->GetMaterial();
+
+		return material.GetBaseColorSRV() == previous_material.GetBaseColorSRV()
+			&& material.GetMaterialSRV()  == previous_material.GetMaterialSRV()
+			&& material.GetNormalSRV()    == previous_material.GetNormalSRV();
+	}
+
+	void DrawList::Sort() {
+		const auto nb_packets = m_packets.size();
+		if (nb_packets < 2u) {
+			return;
+		}
+
+		// Least significant digit radix sort with 8-bit digits.
+		m_scratch.resize(nb_packets);
+
+		for (U32 shift = 0u; shift < 64u; shift += 8u) {
+			std::size_t offsets[256] = {};
+			for (const auto& packet : m_packets) {
+				++offsets[(packet.m_key >> shift) & 0xFFu];
+			}
+
+			// Skip the digit if all keys share this digit.
+			if (nb_packets == offsets[(m_packets.front().m_key >> shift) & 0xFFu]) {
+				continue;
+			}
+
+			std::size_t offset = 0u;
+			for (auto& count : offsets) {
+				const auto next_offset = offset + count;
+				count  = offset;
+				offset = next_offset;
+			}
+
+			for (const auto& packet : m_packets) {
+				m_scratch[offsets[(packet.m_key >> shift) & 0xFFu]++] = packet;
+			}
+
+			m_packets.swap(m_scratch);
+		}
+	}
+}
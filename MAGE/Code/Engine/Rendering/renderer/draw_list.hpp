@@ -0,0 +1,295 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\model\model.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// DrawPacket
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of draw packets.
+	 */
+	struct DrawPacket {
+
+		/**
+		 The sort key of this draw packet.
+		 */
+		U64 m_key = 0u;
+
+		/**
+		 A pointer to the model of this draw packet.
+		 */
+		const Model* m_model = nullptr;
+	};
+
+	static_assert(16 == sizeof(DrawPacket));
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// DrawList
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different draw orders of a draw list.
+
+	 This contains:
+	 @c State and
+	 @c BackToFront.
+	 */
+	enum class DrawOrder : U8 {
+		State = 0,   // Sorted by mesh, material and front-to-back depth.
+		BackToFront  // Sorted by back-to-front depth, mesh and material.
+	};
+
+	/**
+	 A class of draw lists.
+
+	 A draw list contains draw packets with 64-bit sort keys composed of the
+	 mesh, the material textures and the view depth of the models. After
+	 sorting, consecutive draws sharing a mesh or material textures are
+	 adjacent, which allows the passes to skip redundant binds.
+	 */
+	class DrawList {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the sort key of the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		depth
+						The view depth of the model.
+		 @param[in]		order
+						The draw order.
+		 @return		The sort key of @a model.
+		 */
+		[[nodiscard]]
+		static U64 GetKey(const Model& model, F32 depth, DrawOrder order) noexcept {
+			return GetKey(GetStateKey(model), depth, order);
+		}
+
+		/**
+		 Returns the sort key of the model with the given state key.
+
+		 @param[in]		state_key
+						The state key of the model.
+		 @param[in]		depth
+						The view depth of the model.
+		 @param[in]		order
+						The draw order.
+		 @return		The sort key of the model.
+		 */
+		[[nodiscard]]
+		static U64 GetKey(U64 state_key, F32 depth, DrawOrder order) noexcept;
+
+		/**
+		 Returns the 48-bit state key of the given model, composed of the mesh
+		 and the material textures of the model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @return		The state key of @a model.
+		 */
+		[[nodiscard]]
+		static U64 GetStateKey(const Model& model) noexcept;
+
+		/**
+		 Checks whether the given models use the same mesh.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		previous
+						A pointer to the previously drawn model.
+		 @return		@c true if @a previous is not equal to @c nullptr
+						and uses the same mesh as @a model. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		static bool SharesMesh(const Model& model,
+							   const Model* previous) noexcept {
+
+			return previous && previous->GetMesh() == model.GetMesh();
+		}
+
+		/**
+		 Checks whether the given models use the same material textures.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		previous
+						A pointer to the previously drawn model.
+		 @return		@c true if @a previous is not equal to @c nullptr
+						and uses the same material textures as @a model.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool SharesTextures(const Model& model,
+								   const Model* previous) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a draw list.
+		 */
+		DrawList() noexcept = default;
+
+		/**
+		 Constructs a draw list from the given draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to copy.
+		 */
+		DrawList(const DrawList& draw_list) = default;
+
+		/**
+		 Constructs a draw list by moving the given draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to move.
+		 */
+		DrawList(DrawList&& draw_list) noexcept = default;
+
+		/**
+		 Destructs this draw list.
+		 */
+		~DrawList() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given draw list to this draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to copy.
+		 @return		A reference to the copy of the given draw list (i.e.
+						this draw list).
+		 */
+		DrawList& operator=(const DrawList& draw_list) = default;
+
+		/**
+		 Moves the given draw list to this draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to move.
+		 @return		A reference to the moved draw list (i.e. this draw
+						list).
+		 */
+		DrawList& operator=(DrawList&& draw_list) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this draw list is empty.
+
+		 @return		@c true if this draw list is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_packets.empty();
+		}
+
+		/**
+		 Returns the number of draw packets contained in this draw list.
+
+		 @return		The number of draw packets contained in this draw
+						list.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_packets.size();
+		}
+
+		/**
+		 Removes all draw packets from this draw list.
+		 */
+		void Clear() noexcept {
+			m_packets.clear();
+		}
+
+		/**
+		 Adds a draw packet for the given model to this draw list.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		key
+						The sort key.
+		 */
+		void Add(const Model& model, U64 key) {
+			m_packets.push_back({ key, &model });
+		}
+
+		/**
+		 Sorts the draw packets of this draw list by increasing sort key.
+		 */
+		void Sort();
+
+		/**
+		 Calls the given action for each draw packet of this draw list.
+
+		 @tparam		ActionT
+						An action to perform on each model. The action must
+						accept @c const @c Model& and @c const @c Model*
+						values (i.e. the model and the previously drawn model
+						of this draw list or @c nullptr).
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEach(ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the draw packets of this draw list.
+		 */
+		std::vector< DrawPacket > m_packets;
+
+		/**
+		 A vector containing the scratch draw packets of this draw list used
+		 for sorting.
+		 */
+		std::vector< DrawPacket > m_scratch;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\draw_list.tpp"
+
+#pragma endregion
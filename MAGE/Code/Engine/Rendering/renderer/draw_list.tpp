@@ -0,0 +1,16 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename ActionT >
+	void DrawList::ForEach(ActionT&& action) const {
+		const Model* previous = nullptr;
+		for (const auto& packet : m_packets) {
+			action(*packet.m_model, previous);
+			previous = packet.m_model;
+		}
+	}
+}
@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\light_clusterer.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Converts the given (linear) depth expressed in camera space to the
+		 corresponding (non-linear) depth expressed in NDC space.
+
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		z
+						The (linear) depth expressed in camera space.
+		 @return		The (non-linear) depth expressed in NDC space.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV CameraZToNDCZ(FXMMATRIX camera_to_projection,
+									  F32 z) noexcept {
+
+			const auto p_proj = XMVector4Transform(
+				XMVectorSet(0.0f, 0.0f, z, 1.0f), camera_to_projection);
+			return XMVectorGetZ(p_proj) / XMVectorGetW(p_proj);
+		}
+	}
+
+	[[nodiscard]]
+	const F32x2 LightClusterer
+		::GetDepthScaleBias(const F32x2& clipping_planes) noexcept {
+
+		const auto log_near = std::log2(clipping_planes[0]);
+		const auto log_far  = std::log2(clipping_planes[1]);
+		const auto scale    = LIGHT_CLUSTER_GRID_Z / (log_far - log_near);
+		return F32x2(scale, -log_near * scale);
+	}
+
+	LightClusterer::LightClusterer(JobSystem& job_system)
+		: m_job_system(job_system),
+		m_omni_spheres(),
+		m_spot_spheres(),
+		m_slices(LIGHT_CLUSTER_GRID_Z),
+		m_clusters(LIGHT_CLUSTER_COUNT),
+		m_indices() {}
+
+	LightClusterer::LightClusterer(LightClusterer&& clusterer) noexcept = default;
+
+	LightClusterer::~LightClusterer() = default;
+
+	LightClusterer& LightClusterer
+		::operator=(LightClusterer&& clusterer) noexcept = default;
+
+	void XM_CALLCONV LightClusterer
+		::Cluster(const AlignedVector< OmniLightBuffer >& omni_lights,
+				  const AlignedVector< SpotLightBuffer >& spot_lights,
+				  FXMMATRIX world_to_camera,
+				  CXMMATRIX camera_to_projection,
+				  const F32x2& clipping_planes) {
+
+		auto& job_system = m_job_system.get();
+
+		// Bound the lights by spheres expressed in camera space.
+		m_omni_spheres.resize(omni_lights.size());
+		job_system.ParallelFor(0u, omni_lights.size(),
+			[this, &omni_lights, &world_to_camera](std::size_t i) noexcept {
+
+			const auto& light   = omni_lights[i];
+			const auto p_camera = XMVector3TransformCoord(XMLoad(light.m_p_world),
+														  world_to_camera);
+			m_omni_spheres[i] = BoundingSphere(p_camera,
+											   1.0f / std::sqrt(light.m_inv_sqr_range));
+		});
+
+		m_spot_spheres.resize(spot_lights.size());
+		job_system.ParallelFor(0u, spot_lights.size(),
+			[this, &spot_lights, &world_to_camera](std::size_t i) noexcept {
+
+			const auto& light   = spot_lights[i];
+			const auto p_camera = XMVector3TransformCoord(XMLoad(light.m_p_world),
+														  world_to_camera);
+			m_spot_spheres[i] = BoundingSphere(p_camera,
+											   1.0f / std::sqrt(light.m_inv_sqr_range));
+		});
+
+		// Assign the lights to the light clusters of each slice.
+		const auto depth_scale_bias = GetDepthScaleBias(clipping_planes);
+		job_system.ParallelFor(0u, m_slices.size(),
+			[this, &camera_to_projection, &depth_scale_bias](std::size_t z) noexcept {
+
+			ClusterSlice(z, camera_to_projection, depth_scale_bias);
+		}, 1u);
+
+		// Concatenate the light index lists of all slices.
+		std::size_t nb_indices = 0u;
+		for (const auto& slice : m_slices) {
+			nb_indices += slice.m_indices.size();
+		}
+		m_indices.resize(nb_indices);
+
+		constexpr std::size_t nb_clusters_per_slice
+			= LIGHT_CLUSTER_GRID_X * LIGHT_CLUSTER_GRID_Y;
+
+		U32 offset = 0u;
+		for (std::size_t z = 0u; z < m_slices.size(); ++z) {
+			const auto& indices = m_slices[z].m_indices;
+			std::copy(indices.cbegin(), indices.cend(),
+					  m_indices.begin() + offset);
+
+			const auto first = z * nb_clusters_per_slice;
+			for (auto i = first; i < first + nb_clusters_per_slice; ++i) {
+				m_clusters[i][0] += offset;
+			}
+
+			offset += static_cast< U32 >(indices.size());
+		}
+	}
+
+	void XM_CALLCONV LightClusterer
+		::ClusterSlice(std::size_t z,
+					   FXMMATRIX camera_to_projection,
+					   const F32x2& depth_scale_bias) {
+
+		auto& slice = m_slices[z];
+		slice.m_indices.clear();
+
+		// The depth range of the slice expressed in camera space.
+		const auto z_min = std::exp2((z      - depth_scale_bias[1])
+									 / depth_scale_bias[0]);
+		const auto z_max = std::exp2((z + 1u - depth_scale_bias[1])
+									 / depth_scale_bias[0]);
+
+		// Gather the lights overlapping the depth range of the slice.
+		const auto overlaps = [z_min, z_max](const BoundingSphere& sphere) noexcept {
+			const auto z = XMVectorGetZ(sphere.Centroid());
+			const auto r = sphere.Radius();
+			return z_min <= z + r && z - r <= z_max;
+		};
+
+		slice.m_omni_lights.clear();
+		for (std::size_t i = 0u; i < m_omni_spheres.size(); ++i) {
+			if (overlaps(m_omni_spheres[i])) {
+				slice.m_omni_lights.push_back(static_cast< U32 >(i));
+			}
+		}
+
+		slice.m_spot_lights.clear();
+		for (std::size_t i = 0u; i < m_spot_spheres.size(); ++i) {
+			if (overlaps(m_spot_spheres[i])) {
+				slice.m_spot_lights.push_back(static_cast< U32 >(i));
+			}
+		}
+
+		// Remap the depth range of the slice to the canonical view volume.
+		const auto ndc_z_min = CameraZToNDCZ(camera_to_projection, z_min);
+		const auto ndc_z_max = CameraZToNDCZ(camera_to_projection, z_max);
+		const auto scale_z   = 1.0f / (ndc_z_max - ndc_z_min);
+		const auto bias_z    = -ndc_z_min * scale_z;
+
+		for (std::size_t y = 0u; y < LIGHT_CLUSTER_GRID_Y; ++y) {
+			// Remap the NDC range of the light cluster along the y axis.
+			const auto ndc_y_min = (2.0f * y)        / LIGHT_CLUSTER_GRID_Y - 1.0f;
+			const auto ndc_y_max = (2.0f * y + 2.0f) / LIGHT_CLUSTER_GRID_Y - 1.0f;
+			const auto scale_y   = 2.0f / (ndc_y_max - ndc_y_min);
+			const auto bias_y    = -(ndc_y_min + ndc_y_max) / (ndc_y_max - ndc_y_min);
+
+			for (std::size_t x = 0u; x < LIGHT_CLUSTER_GRID_X; ++x) {
+				// Remap the NDC range of the light cluster along the x axis.
+				const auto ndc_x_min = (2.0f * x)        / LIGHT_CLUSTER_GRID_X - 1.0f;
+				const auto ndc_x_max = (2.0f * x + 2.0f) / LIGHT_CLUSTER_GRID_X - 1.0f;
+				const auto scale_x   = 2.0f / (ndc_x_max - ndc_x_min);
+				const auto bias_x    = -(ndc_x_min + ndc_x_max) / (ndc_x_max - ndc_x_min);
+
+				const XMMATRIX projection_to_cluster(
+					scale_x, 0.0f,    0.0f,    0.0f,
+					0.0f,    scale_y, 0.0f,    0.0f,
+					0.0f,    0.0f,    scale_z, 0.0f,
+					bias_x,  bias_y,  bias_z,  1.0f);
+				const BoundingFrustum frustum(camera_to_projection
+											  * projection_to_cluster);
+
+				const auto offset = static_cast< U32 >(slice.m_indices.size());
+				U32 nb_lights = 0u;
+
+				for (const auto i : slice.m_omni_lights) {
+					if (LIGHT_CLUSTER_MAX_LIGHTS == nb_lights) {
+						break;
+					}
+					if (frustum.Overlaps(m_omni_spheres[i])) {
+						slice.m_indices.push_back(i);
+						++nb_lights;
+					}
+				}
+
+				const auto nb_omni_lights = nb_lights;
+
+				for (const auto i : slice.m_spot_lights) {
+					if (LIGHT_CLUSTER_MAX_LIGHTS == nb_lights) {
+						break;
+					}
+					if (frustum.Overlaps(m_spot_spheres[i])) {
+						slice.m_indices.push_back(i);
+						++nb_lights;
+					}
+				}
+
+				const auto cluster = x + LIGHT_CLUSTER_GRID_X
+					               * (y + LIGHT_CLUSTER_GRID_Y * z);
+				m_clusters[cluster] = U32x4(offset,
+											nb_omni_lights,
+											nb_lights - nb_omni_lights,
+											0u);
+			}
+		}
+	}
+}
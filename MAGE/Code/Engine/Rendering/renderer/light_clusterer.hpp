@@ -0,0 +1,234 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\scene_buffer.hpp"
+#include "geometry\bounding_volume.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of light clusterers.
+
+	 A light clusterer assigns the omni lights and spotlights to the light
+	 clusters of the light cluster grid of a camera on the CPU. The view
+	 frustum of the camera is partitioned uniformly in NDC space along the x
+	 and y axis, and exponentially in camera space along the z axis. Each
+	 light is bounded by a sphere which is tested against the bounding
+	 frustum of each light cluster of the depth slices it overlaps. The
+	 depth slices are processed in parallel.
+
+	 The light clusterer serves as the reference implementation of the light
+	 clustering compute shader, and produces the same light clusters, albeit
+	 with a compact light index list.
+	 */
+	class LightClusterer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the scale and bias converting the base-2 logarithm of a
+		 camera space depth to a light cluster slice.
+
+		 @param[in]		clipping_planes
+						A reference to the clipping planes of the camera
+						expressed in camera space.
+		 @return		The scale and bias converting the base-2 logarithm
+						of a camera space depth to a light cluster slice.
+		 */
+		[[nodiscard]]
+		static const F32x2 GetDepthScaleBias(
+			const F32x2& clipping_planes) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a light clusterer.
+
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 */
+		explicit LightClusterer(JobSystem& job_system);
+
+		/**
+		 Constructs a light clusterer from the given light clusterer.
+
+		 @param[in]		clusterer
+						A reference to the light clusterer to copy.
+		 */
+		LightClusterer(const LightClusterer& clusterer) = delete;
+
+		/**
+		 Constructs a light clusterer by moving the given light clusterer.
+
+		 @param[in]		clusterer
+						A reference to the light clusterer to move.
+		 */
+		LightClusterer(LightClusterer&& clusterer) noexcept;
+
+		/**
+		 Destructs this light clusterer.
+		 */
+		~LightClusterer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given light clusterer to this light clusterer.
+
+		 @param[in]		clusterer
+						A reference to the light clusterer to copy.
+		 @return		A reference to the copy of the given light clusterer
+						(i.e. this light clusterer).
+		 */
+		LightClusterer& operator=(const LightClusterer& clusterer) = delete;
+
+		/**
+		 Moves the given light clusterer to this light clusterer.
+
+		 @param[in]		clusterer
+						A reference to the light clusterer to move.
+		 @return		A reference to the moved light clusterer (i.e. this
+						light clusterer).
+		 */
+		LightClusterer& operator=(LightClusterer&& clusterer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Assigns the given lights to the light clusters of the given camera.
+
+		 @param[in]		omni_lights
+						A reference to a vector containing the omni light
+						buffers.
+		 @param[in]		spot_lights
+						A reference to a vector containing the spotlight
+						buffers.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		clipping_planes
+						A reference to the clipping planes of the camera
+						expressed in camera space.
+		 */
+		void XM_CALLCONV Cluster(const AlignedVector< OmniLightBuffer >& omni_lights,
+								 const AlignedVector< SpotLightBuffer >& spot_lights,
+								 FXMMATRIX world_to_camera,
+								 CXMMATRIX camera_to_projection,
+								 const F32x2& clipping_planes);
+
+		/**
+		 Returns the light clusters of this light clusterer.
+
+		 @return		A reference to a vector containing the offset into
+						the light index list, the number of omni lights and
+						the number of spotlights of each light cluster.
+		 */
+		[[nodiscard]]
+		const AlignedVector< U32x4 >& GetClusters() const noexcept {
+			return m_clusters;
+		}
+
+		/**
+		 Returns the light index list of this light clusterer.
+
+		 @return		A reference to a vector containing the light index
+						list of this light clusterer.
+		 */
+		[[nodiscard]]
+		const AlignedVector< U32 >& GetIndices() const noexcept {
+			return m_indices;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of depth slices of the light cluster grid.
+		 */
+		struct Slice {
+
+			/**
+			 The indices of the omni lights overlapping this slice.
+			 */
+			std::vector< U32 > m_omni_lights;
+
+			/**
+			 The indices of the spotlights overlapping this slice.
+			 */
+			std::vector< U32 > m_spot_lights;
+
+			/**
+			 The light index list of the light clusters of this slice.
+			 */
+			std::vector< U32 > m_indices;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void XM_CALLCONV ClusterSlice(std::size_t z,
+									  FXMMATRIX camera_to_projection,
+									  const F32x2& depth_scale_bias);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the job system of this light clusterer.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
+		/**
+		 The bounding spheres of the omni lights expressed in camera space
+		 of this light clusterer.
+		 */
+		AlignedVector< BoundingSphere > m_omni_spheres;
+
+		/**
+		 The bounding spheres of the spotlights expressed in camera space of
+		 this light clusterer.
+		 */
+		AlignedVector< BoundingSphere > m_spot_spheres;
+
+		/**
+		 The depth slices of this light clusterer.
+		 */
+		std::vector< Slice > m_slices;
+
+		/**
+		 The light clusters of this light clusterer.
+		 */
+		AlignedVector< U32x4 > m_clusters;
+
+		/**
+		 The light index list of this light clusterer.
+		 */
+		AlignedVector< U32 > m_indices;
+	};
+}
@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\model_culler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ModelCuller::ModelCuller()
+		: m_world_aabbs(),
+		m_aabbs(),
+		m_bvh(),
+		m_models(),
+		m_models_changed(false) {}
+
+	ModelCuller::ModelCuller(ModelCuller&& culler) noexcept = default;
+
+	ModelCuller::~ModelCuller() = default;
+
+	ModelCuller& ModelCuller::operator=(ModelCuller&& culler) noexcept = default;
+
+	void ModelCuller::Gather(const World& world) {
+		m_world_aabbs.clear();
+		m_world_aabbs.reserve(world.GetNumberOf< Model >());
+
+		// Gather the models in place to detect changes of the set of models.
+		std::size_t nb_models = 0u;
+		world.ForEach< Model >([this, &nb_models](const Model& model) {
+			if (State::Active != model.GetState()) {
+				return;
+			}
+
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+
+			m_world_aabbs.push_back(AABB::Transform(model.GetAABB(), object_to_world));
+
+			if (nb_models == m_models.size()) {
+				m_models.push_back(&model);
+				m_models_changed = true;
+			}
+			else if (&model != m_models[nb_models]) {
+				m_models[nb_models] = &model;
+				m_models_changed = true;
+			}
+
+			++nb_models;
+		});
+
+		if (nb_models != m_models.size()) {
+			m_models.resize(nb_models);
+			m_models_changed = true;
+		}
+	}
+
+	void ModelCuller::Build() {
+		if (UsesBVH()) {
+			m_aabbs.Clear();
+
+			if (m_models_changed
+				|| m_bvh.GetCost() > s_bvh_rebuild_ratio * m_bvh.GetBuildCost()) {
+				m_bvh.Build(m_world_aabbs);
+			}
+			else {
+				m_bvh.Refit(m_world_aabbs);
+			}
+		}
+		else {
+			m_bvh.Clear();
+
+			m_aabbs.Clear();
+			m_aabbs.Reserve(m_world_aabbs.size());
+			for (const auto& aabb : m_world_aabbs) {
+				m_aabbs.Add(aabb);
+			}
+		}
+
+		m_models_changed = false;
+	}
+
+	void XM_CALLCONV ModelCuller::Cull(FXMMATRIX world_to_projection,
+									   VisibilityMask& visibility) const {
+
+		const BoundingFrustum frustum(world_to_projection);
+		Cull(frustum, visibility);
+	}
+}
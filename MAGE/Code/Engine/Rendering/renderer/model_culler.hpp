@@ -0,0 +1,270 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of model cullers.
+
+	 A model culler gathers the world-space AABBs of all active models of a
+	 world once per frame, builds its culling structures for these AABBs, and
+	 culls these AABBs in batch against the view frustum of each camera.
+	 Building does not access the world, and can thus run concurrently with
+	 the simulation of the next frame. Small sets of models are culled linearly in
+	 packets of four AABBs. Larger sets of models are culled hierarchically
+	 with a BVH which is refitted each frame, and rebuilt whenever the set of
+	 models changes or the quality of the refitted BVH degrades too much.
+	 */
+	class ModelCuller {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a model culler.
+		 */
+		ModelCuller();
+
+		/**
+		 Constructs a model culler from the given model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to copy.
+		 */
+		ModelCuller(const ModelCuller& culler) = delete;
+
+		/**
+		 Constructs a model culler by moving the given model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to move.
+		 */
+		ModelCuller(ModelCuller&& culler) noexcept;
+
+		/**
+		 Destructs this model culler.
+		 */
+		~ModelCuller();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given model culler to this model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to copy.
+		 @return		A reference to the copy of the given model culler
+						(i.e. this model culler).
+		 */
+		ModelCuller& operator=(const ModelCuller& culler) = delete;
+
+		/**
+		 Moves the given model culler to this model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to move.
+		 @return		A reference to the moved model culler (i.e. this model
+						culler).
+		 */
+		ModelCuller& operator=(ModelCuller&& culler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of models gathered by this model culler.
+
+		 @return		The number of models gathered by this model culler.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_models.size();
+		}
+
+		/**
+		 Returns the gathered model at the given index.
+
+		 @pre			@a index is smaller than the number of models
+						gathered by this model culler.
+		 @param[in]		index
+						The index of the model.
+		 @return		A reference to the gathered model at @a index.
+		 */
+		[[nodiscard]]
+		const Model& GetModel(std::size_t index) const noexcept {
+			return *m_models[index];
+		}
+
+		/**
+		 Returns the world-space AABB of the gathered model at the given
+		 index.
+
+		 @pre			@a index is smaller than the number of models
+						gathered by this model culler.
+		 @param[in]		index
+						The index of the model.
+		 @return		A reference to the world-space AABB of the gathered
+						model at @a index.
+		 */
+		[[nodiscard]]
+		const AABB& GetWorldAABB(std::size_t index) const noexcept {
+			return m_world_aabbs[index];
+		}
+
+		/**
+		 Gathers the world-space AABBs of the active models of the given
+		 world. The culling structures of this model culler need to be built
+		 before culling.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Gather(const World& world);
+
+		/**
+		 Builds the culling structures of the gathered world-space AABBs of
+		 this model culler.
+		 */
+		void Build();
+
+		/**
+		 Culls the gathered models against the view frustum of the given
+		 world-to-projection transformation matrix.
+
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 @param[out]	visibility
+						A reference to the visibility mask which will contain
+						a set bit for each gathered model overlapping the view
+						frustum.
+		 */
+		void XM_CALLCONV Cull(FXMMATRIX world_to_projection,
+							  VisibilityMask& visibility) const;
+
+		/**
+		 Culls the gathered models against the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[out]	visibility
+						A reference to the visibility mask which will contain
+						a set bit for each gathered model overlapping
+						@a volume.
+		 */
+		template< typename BoundingVolumeT >
+		void Cull(const BoundingVolumeT& volume,
+				  VisibilityMask& visibility) const;
+
+		/**
+		 Calls the given action for each gathered model which is visible
+		 according to the given visibility mask.
+
+		 @pre			@a visibility is obtained by culling the models of
+						this model culler.
+		 @tparam		ActionT
+						An action to perform on each visible model. The action
+						must accept @c const @c Model& values.
+		 @param[in]		visibility
+						A reference to the visibility mask.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEach(const VisibilityMask& visibility,
+					 ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The minimum number of models to cull with a BVH.
+		 */
+		static constexpr std::size_t s_bvh_threshold = 256u;
+
+		/**
+		 The maximum ratio of the cost of a refitted BVH to the cost of the
+		 originally built BVH.
+		 */
+		static constexpr F32 s_bvh_rebuild_ratio = 1.5f;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this model culler uses a BVH for culling.
+
+		 @return		@c true if this model culler uses a BVH for culling.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool UsesBVH() const noexcept {
+			return s_bvh_threshold <= m_models.size();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the world-space AABBs of the models of this
+		 model culler.
+		 */
+		AlignedVector< AABB > m_world_aabbs;
+
+		/**
+		 The world-space AABBs of the models of this model culler in packets
+		 of four AABBs (if no BVH is used).
+		 */
+		AABBBatch m_aabbs;
+
+		/**
+		 The BVH of the world-space AABBs of the models of this model culler
+		 (if a BVH is used).
+		 */
+		BVH m_bvh;
+
+		/**
+		 A vector containing pointers to the models of this model culler.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 A flag indicating whether the set of models of this model culler
+		 changed since the last build.
+		 */
+		bool m_models_changed;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\model_culler.tpp"
+
+#pragma endregion
@@ -0,0 +1,36 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename BoundingVolumeT >
+	void ModelCuller::Cull(const BoundingVolumeT& volume,
+						   VisibilityMask& visibility) const {
+
+		if (UsesBVH()) {
+			m_bvh.Query(volume, visibility);
+		}
+		else if constexpr (std::is_same_v< BoundingFrustum, BoundingVolumeT >) {
+			m_aabbs.Cull(volume, visibility);
+		}
+		else {
+			visibility.Reset(m_world_aabbs.size());
+			for (std::size_t i = 0u; i < m_world_aabbs.size(); ++i) {
+				if (volume.Overlaps(m_world_aabbs[i])) {
+					visibility.Set(i);
+				}
+			}
+		}
+	}
+
+	template< typename ActionT >
+	void ModelCuller::ForEach(const VisibilityMask& visibility,
+							  ActionT&& action) const {
+
+		visibility.ForEach([this, &action](std::size_t index) {
+			action(*m_models[index]);
+		});
+	}
+}
@@ -95,8 +95,10 @@ namespace mage::rendering {
 		m_transform_buffer.Bind< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 	}
 
-	void XM_CALLCONV BoundingVolumePass::Render(const World& world,
-												FXMMATRIX world_to_projection) {
+	void BoundingVolumePass::Render(const RenderFrame& frame,
+									const RenderView& view) {
+		const auto world_to_projection = view.m_world_to_projection;
+
 		// Bind the fixed state.
 		BindFixedState();
 
@@ -104,81 +106,53 @@ namespace mage::rendering {
 		BindLightColor();
 
 		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, world_to_projection](const DirectionalLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform            = light.GetOwner()->GetTransform();
-			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  object_to_projection = object_to_world * world_to_projection;
-			const auto& aabb                 = light.GetAABB();
+		for (const auto& light : frame.GetDirectionalLights()) {
+			const auto object_to_projection = light.m_light_to_world * world_to_projection;
 
 			// Apply view frustum culling.
-			if (BoundingFrustum::Cull(object_to_projection, aabb)) {
-				return;
+			if (BoundingFrustum::Cull(object_to_projection, light.m_aabb)) {
+				continue;
 			}
 
-			Render(aabb, object_to_world);
-		});
+			Render(light.m_aabb, light.m_light_to_world);
+		}
 
 		// Process the omni lights.
-		world.ForEach< OmniLight >([this, world_to_projection](const OmniLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform            = light.GetOwner()->GetTransform();
-			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  object_to_projection = object_to_world * world_to_projection;
+		for (const auto& light : frame.GetOmniLights()) {
+			const auto object_to_projection = light.m_light_to_world * world_to_projection;
 
 			// Apply view frustum culling.
-			if (BoundingFrustum::Cull(object_to_projection, light.GetBoundingSphere())) {
-				return;
+			if (BoundingFrustum::Cull(object_to_projection, light.m_sphere)) {
+				continue;
 			}
 
-			Render(light.GetAABB(), object_to_world);
-		});
+			Render(light.m_aabb, light.m_light_to_world);
+		}
 
 		// Process the spot lights.
-		world.ForEach< SpotLight >([this, world_to_projection](const SpotLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform            = light.GetOwner()->GetTransform();
-			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  object_to_projection = object_to_world * world_to_projection;
-			const auto& aabb                 = light.GetAABB();
+		for (const auto& light : frame.GetSpotLights()) {
+			const auto object_to_projection = light.m_light_to_world * world_to_projection;
 
 			// Apply view frustum culling.
-			if (BoundingFrustum::Cull(object_to_projection, aabb)) {
-				return;
+			if (BoundingFrustum::Cull(object_to_projection, light.m_aabb)) {
+				continue;
 			}
 
-			Render(aabb, object_to_world);
-		});
+			Render(light.m_aabb, light.m_light_to_world);
+		}
 
 		// Bind the model color.
 		BindModelColor();
 
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			const auto& transform            = model.GetOwner()->GetTransform();
-			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  object_to_projection = object_to_world * world_to_projection;
-			const auto& aabb                 = model.GetAABB();
-
-			// Apply view frustum culling.
-			if (BoundingFrustum::Cull(object_to_projection, aabb)) {
-				return;
-			}
+		// Process the visible models.
+		const auto& culler  = frame.GetModelCuller();
+		const auto& buffers = frame.GetModelBuffers();
+		view.m_visibility.ForEach([this, &culler, &buffers](std::size_t index) {
+			// The model buffer contains the transposed object-to-world matrix.
+			const auto object_to_world
+				= XMMatrixTranspose(buffers[index].m_object_to_world);
 
-			Render(aabb, object_to_world);
+			Render(culler.GetModel(index).GetAABB(), object_to_world);
 		});
 	}
 
@@ -7,7 +7,7 @@
 
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\render_frame.hpp"
 
 #pragma endregion
 
@@ -96,17 +96,16 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the world.
+		 Renders the given render view of the given render frame.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		frame
+						A reference to the render frame.
+		 @param[in]		view
+						A reference to the render view.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection);
+		void Render(const RenderFrame& frame, const RenderView& view);
 
 	private:
 
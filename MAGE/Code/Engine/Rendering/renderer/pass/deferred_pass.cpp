@@ -4,7 +4,6 @@
 #pragma region
 
 #include "renderer\pass\deferred_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -22,7 +21,9 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)) {}
+		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)),
+		m_msaa_ps(),
+		m_cs() {}
 
 	DeferredPass::DeferredPass(DeferredPass&& pass) noexcept = default;
 
@@ -57,9 +58,12 @@ namespace mage::rendering {
 		// Binds the fixed state.
 		BindFixedState();
 
-		const auto ps = CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		const auto index = GetDeferredPermutationIndex(brdf, vct);
+		const auto& ps = m_msaa_ps.GetOrCreate(index, [&]() {
+			return CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		});
 		// PS: Bind the pixel shader.
-		ps->BindShader(m_device_context);
+		ps.BindShader(m_device_context);
 
 		// Draw the fullscreen triangle.
 		Pipeline::Draw(m_device_context, 3u, 0u);
@@ -68,9 +72,12 @@ namespace mage::rendering {
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
 
-		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
+		const auto index = GetDeferredPermutationIndex(brdf, vct);
+		const auto& cs = m_cs.GetOrCreate(index, [&]() {
+			return CreateDeferredCS(m_resource_manager, brdf, vct);
+		});
 		// CS: Bind the compute shader.
-		cs->BindShader(m_device_context);
+		cs.BindShader(m_device_context);
 
 		// Dispatch the pass.
 		const auto nb_groups_x = GetNumberOfGroups(viewport_size[0],
@@ -8,6 +8,8 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_factory.hpp"
+#include "resource\shader\shader_permutation_table.hpp"
 
 #pragma endregion
 
@@ -153,5 +155,19 @@ namespace mage::rendering {
 		 A pointer to the vertex shader of this deferred pass.
 		 */
 		VertexShaderPtr m_msaa_vs;
+
+		/**
+		 The MSAA pixel shaders of this deferred pass indexed by their
+		 deferred permutation index.
+		 */
+		ShaderPermutationTable< PixelShader,
+			                    g_nb_deferred_permutations > m_msaa_ps;
+
+		/**
+		 The compute shaders of this deferred pass indexed by their deferred
+		 permutation index.
+		 */
+		ShaderPermutationTable< ComputeShader,
+			                    g_nb_deferred_permutations > m_cs;
 	};
 }
\ No newline at end of file
@@ -25,6 +25,7 @@ namespace mage::rendering {
 		m_opaque_vs(CreateDepthVS(resource_manager)),
 		m_transparent_vs(CreateDepthTransparentVS(resource_manager)),
 		m_transparent_ps(CreateDepthTransparentPS(resource_manager)),
+		m_clear_vs(CreateFarFullscreenTriangleVS(resource_manager)),
 		m_camera_buffer(device) {}
 
 	DepthPass::DepthPass(DepthPass&& pass) noexcept = default;
@@ -67,6 +68,40 @@ namespace mage::rendering {
 		#endif // DISABLE_INVERTED_Z_BUFFER
 	}
 
+	void DepthPass::ClearViewport() const noexcept {
+		// IA: Bind the primitive topology.
+		Pipeline::IA::BindPrimitiveTopology(m_device_context,
+											D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		// VS: Bind the vertex shader.
+		m_clear_vs->BindShader(m_device_context);
+		// RS: Bind the rasterization state.
+		m_state_manager.get().Bind(m_device_context,
+								   RasterizerStateID::NoCulling);
+		// PS: Bind the pixel shader.
+		Pipeline::PS::BindShader(m_device_context, nullptr);
+		// OM: Bind the depth-stencil state (which always passes for the far
+		// plane).
+		#ifdef DISABLE_INVERTED_Z_BUFFER
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::GreaterEqualDepthReadWrite);
+		#else  // DISABLE_INVERTED_Z_BUFFER
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::LessEqualDepthReadWrite);
+		#endif // DISABLE_INVERTED_Z_BUFFER
+
+		// Draw the fullscreen triangle.
+		Pipeline::Draw(m_device_context, 3u, 0u);
+
+		// OM: Restore the depth-stencil state.
+		#ifdef DISABLE_INVERTED_Z_BUFFER
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::LessDepthReadWrite);
+		#else  // DISABLE_INVERTED_Z_BUFFER
+		m_state_manager.get().Bind(m_device_context,
+								   DepthStencilStateID::GreaterDepthReadWrite);
+		#endif // DISABLE_INVERTED_Z_BUFFER
+	}
+
 	void XM_CALLCONV DepthPass::BindCamera(FXMMATRIX world_to_camera,
 										   CXMMATRIX camera_to_projection) {
 		SecondaryCameraBuffer buffer;
@@ -80,14 +115,12 @@ namespace mage::rendering {
 											 SLOT_CBUFFER_SECONDARY_CAMERA);
 	}
 
-	void XM_CALLCONV DepthPass::Render(const World& world,
+	void XM_CALLCONV DepthPass::Render(const VisibleSet& visible_set,
 									   FXMMATRIX world_to_camera,
 									   CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
 		//---------------------------------------------------------------------
 		// All opaque models.
 		//---------------------------------------------------------------------
@@ -96,14 +129,10 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-
-			RenderOpaque(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::DepthOpaque,
+			[this](const Model& model, const Model* previous) {
+				RenderOpaque(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -113,28 +142,19 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			RenderTransparent(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::DepthTransparent,
+			[this](const Model& model, const Model* previous) {
+				RenderTransparent(model, previous);
+			});
 	}
 
-	void XM_CALLCONV DepthPass::RenderOccluders(const World& world,
+	void XM_CALLCONV DepthPass::RenderOccluders(const ModelCuller& culler,
+												const ShadowCasters& casters,
 												FXMMATRIX world_to_camera,
 												CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
 		//---------------------------------------------------------------------
 		// All opaque models.
 		//---------------------------------------------------------------------
@@ -143,15 +163,12 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-
-			RenderOpaque(model, world_to_projection);
-		});
+		const Model* previous = nullptr;
+		for (const auto index : casters.m_opaque_models) {
+			const auto& model = culler.GetModel(index);
+			RenderOpaque(model, previous);
+			previous = &model;
+		}
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -161,62 +178,50 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			RenderTransparent(model, world_to_projection);
-		});
+		previous = nullptr;
+		for (const auto index : casters.m_transparent_models) {
+			const auto& model = culler.GetModel(index);
+			RenderTransparent(model, previous);
+			previous = &model;
+		}
 	}
 
-	void XM_CALLCONV DepthPass::RenderOpaque(const Model& model,
-											 FXMMATRIX world_to_projection) const noexcept {
+	void DepthPass::RenderOpaque(const Model& model,
+								 const Model* previous) const noexcept {
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
+		// View frustum culling is already applied by the visible set.
 
 		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::VS >(SLOT_CBUFFER_MODEL);
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		if (!DrawList::SharesMesh(model, previous)) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
 
-	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
-												  FXMMATRIX world_to_projection) const noexcept {
+	void DepthPass::RenderTransparent(const Model& model,
+									  const Model* previous) const noexcept {
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+		// View frustum culling is already applied by the visible set.
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
+		const auto base_color_srv = model.GetMaterial().GetBaseColorSRV();
 
 		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::VS >(SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::PS >(SLOT_CBUFFER_MODEL);
 		// Bind the SRV of the model.
-		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_BASE_COLOR,
-							  model.GetMaterial().GetBaseColorSRV());
+		if (!previous
+			|| previous->GetMaterial().GetBaseColorSRV() != base_color_srv) {
+			Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_BASE_COLOR,
+								  base_color_srv);
+		}
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		if (!DrawList::SharesMesh(model, previous)) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
-}
\ No newline at end of file
+}
@@ -7,7 +7,8 @@
 
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\visible_set.hpp"
+#include "renderer\shadow_caster_cache.hpp"
 
 #pragma endregion
 
@@ -102,10 +103,10 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the world.
+		 Renders the visible models.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
@@ -113,15 +114,18 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
+		void XM_CALLCONV Render(const VisibleSet& visible_set,
 								FXMMATRIX world_to_camera,
 								CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the occluders of the world.
+		 Renders the given shadow casters.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		culler
+						A reference to the model culler.
+		 @param[in]		casters
+						A reference to the shadow casters of the models of
+						the given model culler.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
@@ -129,10 +133,18 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderOccluders(const World& world,
+		void XM_CALLCONV RenderOccluders(const ModelCuller& culler,
+										 const ShadowCasters& casters,
 										 FXMMATRIX world_to_camera,
 										 CXMMATRIX camera_to_projection);
 
+		/**
+		 Clears the depth of the bound viewport of the bound DSV to the far
+		 plane (as opposed to clearing the complete DSV). The rasterizer state
+		 is not restored.
+		 */
+		void ClearViewport() const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -167,22 +179,24 @@ namespace mage::rendering {
 
 		 @param[in]		model
 						A reference to the opaque model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously drawn model of the same
+						draw list. This pointer may be equal to @c nullptr.
 		 */
-		void XM_CALLCONV RenderOpaque(const Model& model,
-									  FXMMATRIX world_to_projection) const noexcept;
+		void RenderOpaque(const Model& model,
+						  const Model* previous) const noexcept;
 
 		/**
 		 Renders the given transparent model.
 
 		 @param[in]		model
 						A reference to the transparent model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously drawn model of the same
+						draw list. This pointer may be equal to @c nullptr.
 		 */
-		void XM_CALLCONV RenderTransparent(const Model& model,
-										   FXMMATRIX world_to_projection) const noexcept;
+		void RenderTransparent(const Model& model,
+							   const Model* previous) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -215,6 +229,12 @@ namespace mage::rendering {
 		 */
 		PixelShaderPtr m_transparent_ps;
 
+		/**
+		 A pointer to the vertex shader for clearing viewports of this depth
+		 pass.
+		 */
+		VertexShaderPtr m_clear_vs;
+
 		/**
 		 The camera buffer of this depth pass.
 		 */
@@ -4,7 +4,6 @@
 #pragma region
 
 #include "renderer\pass\forward_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
 #include "resource\texture\texture_factory.hpp"
 
 // Include HLSL bindings.
@@ -25,6 +24,11 @@ namespace mage::rendering {
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
 		m_vs(CreateTransformVS(resource_manager)),
+		m_solid_ps(CreateForwardSolidPS(resource_manager)),
+		m_forward_ps(),
+		m_forward_emissive_ps(),
+		m_gbuffer_ps(),
+		m_false_color_ps(),
 		m_uv(CreateReferenceTexture(resource_manager)),
 		m_color_buffer(device) {}
 
@@ -116,9 +120,8 @@ namespace mage::rendering {
 		m_color_buffer.Bind< Pipeline::PS >(m_device_context, SLOT_CBUFFER_COLOR);
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const World& world,
-										 FXMMATRIX world_to_projection,
-										 BRDF brdf, bool vct) const {
+	void ForwardPass::Render(const VisibleSet& visible_set,
+							 BRDF brdf, bool vct) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -128,81 +131,51 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::OpaqueEmissive,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::Opaque,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::OpaqueTSNM,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderSolid(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderSolid(const VisibleSet& visible_set) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -210,23 +183,18 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardSolidPS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_solid_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::All,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world,
-												FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderGBuffer(const VisibleSet& visible_set) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -235,54 +203,35 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::Opaque,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::OpaqueTSNM,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world,
-												 FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderEmissive(const VisibleSet& visible_set) const {
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -292,31 +241,21 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::OpaqueEmissive,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderTransparent(const World& world,
-													FXMMATRIX world_to_projection,
-													BRDF brdf,
-													bool vct) const {
+	void ForwardPass::RenderTransparent(const VisibleSet& visible_set,
+										BRDF brdf,
+										bool vct) const {
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
@@ -326,85 +265,52 @@ namespace mage::rendering {
 		// All transparent emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::TransparentEmissive,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All transparent models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::Transparent,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 
 		//---------------------------------------------------------------------
 		// All transparent models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::TransparentTSNM,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world,
-												   FXMMATRIX world_to_projection,
-												   FalseColor false_color) const {
+	void ForwardPass::RenderFalseColor(const VisibleSet& visible_set,
+									   FalseColor false_color) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -416,24 +322,19 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 false_color);
+			const auto& ps = GetFalseColorPS(false_color);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::All,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world,
-												  FXMMATRIX world_to_projection) {
+	void ForwardPass::RenderWireframe(const VisibleSet& visible_set) {
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -445,52 +346,82 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 FalseColor::ConstantColor);
+			const auto& ps = GetFalseColorPS(FalseColor::ConstantColor);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			ps.BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		visible_set.ForEach(ModelBucket::All,
+			[this](const Model& model, const Model* previous) {
+				Render(model, previous);
+			});
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const Model& model,
-										 FXMMATRIX world_to_projection) const noexcept {
+	void ForwardPass::Render(const Model& model,
+							 const Model* previous) const noexcept {
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+		// View frustum culling is already applied by the visible set.
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
-		const auto& material             = model.GetMaterial();
+		const auto& material = model.GetMaterial();
 
 		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::VS >(SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::PS >(SLOT_CBUFFER_MODEL);
 		// Bind the SRVs of the model.
-		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
-		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
-		ID3D11ShaderResourceView* const srvs[] = {
-			material.GetBaseColorSRV(),
-			material.GetMaterialSRV(),
-			material.GetNormalSRV()
-		};
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
-							   static_cast< U32 >(std::size(srvs)), srvs);
+		if (!DrawList::SharesTextures(model, previous)) {
+			static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
+			static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
+			ID3D11ShaderResourceView* const srvs[] = {
+				material.GetBaseColorSRV(),
+				material.GetMaterialSRV(),
+				material.GetNormalSRV()
+			};
+			Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
+								   static_cast< U32 >(std::size(srvs)), srvs);
+		}
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		if (!DrawList::SharesMesh(model, previous)) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
-}
\ No newline at end of file
+
+	[[nodiscard]]
+	const PixelShader& ForwardPass::GetForwardPS(BRDF brdf,
+												 bool transparency,
+												 bool vct,
+												 bool tsnm) const {
+
+		const auto index = GetForwardPermutationIndex(brdf, transparency, vct, tsnm);
+		return m_forward_ps.GetOrCreate(index, [&]() {
+			return CreateForwardPS(m_resource_manager,
+								   brdf, transparency, vct, tsnm);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ForwardPass::GetForwardEmissivePS(bool transparency) const {
+		const auto index = static_cast< std::size_t >(transparency);
+		return m_forward_emissive_ps.GetOrCreate(index, [&]() {
+			return CreateForwardEmissivePS(m_resource_manager, transparency);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ForwardPass::GetGBufferPS(bool tsnm) const {
+		const auto index = static_cast< std::size_t >(tsnm);
+		return m_gbuffer_ps.GetOrCreate(index, [&]() {
+			return CreateGBufferPS(m_resource_manager, tsnm);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ForwardPass::GetFalseColorPS(FalseColor false_color) const {
+		const auto index = static_cast< std::size_t >(false_color);
+		return m_false_color_ps.GetOrCreate(index, [&]() {
+			return CreateFalseColorPS(m_resource_manager, false_color);
+		});
+	}
+}
@@ -6,9 +6,11 @@
 #pragma region
 
 #include "renderer\configuration.hpp"
+#include "renderer\visible_set.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "resource\shader\shader_factory.hpp"
+#include "resource\shader\shader_permutation_table.hpp"
 
 #pragma endregion
 
@@ -97,12 +99,10 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the given world.
+		 Renders the visible models.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
@@ -111,56 +111,44 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-								FXMMATRIX world_to_projection,
-								BRDF brdf, bool vct) const;
+		void Render(const VisibleSet& visible_set,
+					BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as solid.
+		 Renders the visible models as solid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderSolid(const World& world,
-									 FXMMATRIX world_to_projection) const;
+		void RenderSolid(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the given world to a GBuffer.
+		 Renders the visible models to a GBuffer.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderGBuffer(const World& world,
-									   FXMMATRIX world_to_projection) const;
+		void RenderGBuffer(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the emissive models of the given world.
+		 Renders the visible emissive models.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderEmissive(const World& world,
-										FXMMATRIX world_to_projection) const;
+		void RenderEmissive(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the transparent models of the given world.
+		 Renders the visible transparent models.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
@@ -169,38 +157,31 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderTransparent(const World& world,
-										   FXMMATRIX world_to_projection,
-										   BRDF brdf, bool vct) const;
+		void RenderTransparent(const VisibleSet& visible_set,
+							   BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as a false color.
+		 Renders the visible models as a false color.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @param[in]		false_color
 						The false color.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color) const;
+		void RenderFalseColor(const VisibleSet& visible_set,
+							  FalseColor false_color) const;
 
 		/**
-		 Renders the given world as a wireframe.
+		 Renders the visible models as a wireframe.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderWireframe(const World& world,
-										 FXMMATRIX world_to_projection);
+		void RenderWireframe(const VisibleSet& visible_set);
 
 	private:
 
@@ -236,13 +217,79 @@ namespace mage::rendering {
 		/**
 		 Renders the given model.
 
+		 The mesh and SRVs of the given model are only bound if they differ
+		 from those of the previously drawn model.
+
 		 @param[in]		model
 						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously drawn model of the same
+						draw list. This pointer may be equal to @c nullptr.
+		 */
+		void Render(const Model& model, const Model* previous) const noexcept;
+
+		/**
+		 Returns the forward pixel shader matching the given BRDF and shader
+		 configuration parameters.
+
+		 @param[in]		brdf
+						The BRDF.
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c false
+						otherwise.
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the forward pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetForwardPS(BRDF brdf,
+										bool transparency,
+										bool vct,
+										bool tsnm) const;
+
+		/**
+		 Returns the forward emissive pixel shader.
+
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @return		A reference to the forward emissive pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetForwardEmissivePS(bool transparency) const;
+
+		/**
+		 Returns the GBuffer pixel shader.
+
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the GBuffer pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		[[nodiscard]]
+		const PixelShader& GetGBufferPS(bool tsnm) const;
+
+		/**
+		 Returns the false color pixel shader.
+
+		 @param[in]		false_color
+						The false color.
+		 @return		A reference to the false color pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetFalseColorPS(FalseColor false_color) const;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -268,6 +315,37 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the solid pixel shader of this forward pass.
+		 */
+		PixelShaderPtr m_solid_ps;
+
+		/**
+		 The forward pixel shaders of this forward pass indexed by their
+		 forward permutation index.
+		 */
+		mutable ShaderPermutationTable< PixelShader,
+			                            g_nb_forward_permutations > m_forward_ps;
+
+		/**
+		 The forward emissive pixel shaders of this forward pass indexed by
+		 transparency.
+		 */
+		mutable ShaderPermutationTable< PixelShader, 2u > m_forward_emissive_ps;
+
+		/**
+		 The GBuffer pixel shaders of this forward pass indexed by tangent
+		 space normal mapping.
+		 */
+		mutable ShaderPermutationTable< PixelShader, 2u > m_gbuffer_ps;
+
+		/**
+		 The false color pixel shaders of this forward pass indexed by false
+		 color.
+		 */
+		mutable ShaderPermutationTable< PixelShader,
+			                            g_nb_false_colors > m_false_color_ps;
+
 		/**
 		 A pointer to the UV reference texture of this forward pass.
 		 */
@@ -4,12 +4,23 @@
 #pragma region
 
 #include "renderer\pass\lbuffer_pass.hpp"
+#include "resource\shader\shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -18,8 +29,10 @@ namespace mage::rendering {
 	LBufferPass::LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager)
+							 ResourceManager& resource_manager,
+							 JobSystem& job_system)
 		: m_device_context(device_context),
+		m_job_system(job_system),
 		m_light_buffer(device),
 		m_directional_lights(device, 3u),
 		m_omni_lights(device, 32u),
@@ -27,16 +40,39 @@ namespace mage::rendering {
 		m_sm_directional_lights(device, 1u),
 		m_sm_omni_lights(device, 1u),
 		m_sm_spot_lights(device, 1u),
-		m_directional_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
+		m_directional_sms(MakeUnique< ShadowMapBuffer >(device, SHADOW_CASCADE_COUNT,
+			U32x2(s_directional_sm_resolution, s_directional_sm_resolution))),
 		m_omni_sms(MakeUnique< ShadowCubeMapBuffer >(device, 1u)),
-		m_spot_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
+		m_spot_sms(MakeUnique< ShadowMapBuffer >(device, 1u,
+			U32x2(s_spot_atlas_resolution, s_spot_atlas_resolution))),
+		m_directional_casters(),
+		m_omni_casters(),
+		m_spot_casters(),
+		m_spot_atlas_packer(s_spot_atlas_resolution),
+		m_spot_atlas_requests(),
+		m_spot_atlas_tiles(),
+		m_light_clusters(MakeUnique< LightClusterBuffer >(device)),
+		m_light_clusterer(job_system),
+		m_light_clustering_cs(CreateLightClusteringCS(resource_manager)),
 		m_directional_light_cameras(),
 		m_omni_light_cameras(),
 		m_spot_light_cameras(),
+		m_directional_light_buffers(),
+		m_omni_light_buffers(),
+		m_spot_light_buffers(),
+		m_sm_directional_light_buffers(),
+		m_sm_omni_light_buffers(),
+		m_sm_spot_light_buffers(),
+		m_light_classes(),
+		m_light_chunks(),
 		m_depth_pass(MakeUnique< DepthPass >(device,
 											 device_context,
 											 state_manager,
-											 resource_manager)) {}
+											 resource_manager)) {
+
+		m_directional_casters.Reset(m_directional_sms->GetNumberOfShadowMaps());
+		m_omni_casters.Reset(m_omni_sms->GetNumberOfShadowMaps());
+	}
 
 	LBufferPass::LBufferPass(LBufferPass&& buffer) noexcept = default;
 
@@ -44,24 +80,23 @@ namespace mage::rendering {
 
 	LBufferPass& LBufferPass::operator=(LBufferPass&& pass) noexcept = default;
 
-	void XM_CALLCONV LBufferPass
-		::Render(const World& world,
-				 FXMMATRIX world_to_projection) {
-
+	void LBufferPass::Render(const RenderFrame& frame, const RenderView& view) {
 		// Process the lights.
-		ProcessDirectionalLights(world, world_to_projection);
-		ProcessOmniLights(world, world_to_projection);
-		ProcessSpotLights(world, world_to_projection);
+		ProcessDirectionalLights(frame, view);
+		ProcessOmniLights(frame, view.m_world_to_projection);
+		ProcessSpotLights(frame, view);
 
 		// Unbind the shadow map SRVs.
 		UnbindShadowMaps();
 		// Setup the shadow maps.
 		SetupShadowMaps();
 		// Render the shadow maps.
-		RenderShadowMaps(world);
+		RenderShadowMaps(frame);
 
 		// Process the lights' data.
-		ProcessLightsData(world);
+		ProcessLightsData(frame, view);
+		// Assign the lights to the light clusters.
+		ClusterLights(view);
 
 		// Bind the LBuffer.
 		BindLBuffer();
@@ -116,269 +151,406 @@ namespace mage::rendering {
 							   static_cast< U32 >(std::size(srvs)), srvs);
 		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS,
 							   static_cast< U32 >(std::size(srvs)), srvs);
-	}
-
-	void LBufferPass::ProcessLightsData(const World& world) {
-		// Accumulate all ambient light spectra.
-		XMVECTOR La = {};
-		world.ForEach< AmbientLight >([&La](const AmbientLight& light) {
-			if (State::Active != light.GetState()) {
-				return;
-			}
 
-			La += XMLoad(light.GetRadianceSpectrum());
-		});
+		// Bind the light cluster SRVs.
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST,
+							  &m_light_clusters->GetIndicesSRV());
+		Pipeline::CS::BindSRV(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST,
+							  &m_light_clusters->GetIndicesSRV());
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_LIGHT_CLUSTERS,
+							  &m_light_clusters->GetClustersSRV());
+		Pipeline::CS::BindSRV(m_device_context, SLOT_SRV_LIGHT_CLUSTERS,
+							  &m_light_clusters->GetClustersSRV());
+	}
 
+	void LBufferPass::ProcessLightsData(const RenderFrame& frame,
+										const RenderView& view) {
 		LightBuffer buffer;
-		buffer.m_La                       = RGB(XMStore< F32x3 >(La));
+		buffer.m_La                       = frame.GetAmbientLight();
 		buffer.m_nb_directional_lights    = static_cast< U32 >(m_directional_lights.size());
 		buffer.m_nb_omni_lights           = static_cast< U32 >(m_omni_lights.size());
 		buffer.m_nb_spot_lights           = static_cast< U32 >(m_spot_lights.size());
 		buffer.m_nb_sm_directional_lights = static_cast< U32 >(m_sm_directional_lights.size());
 		buffer.m_nb_sm_omni_lights        = static_cast< U32 >(m_sm_omni_lights.size());
 		buffer.m_nb_sm_spot_lights        = static_cast< U32 >(m_sm_spot_lights.size());
+		buffer.m_light_cluster_depth      = LightClusterer::GetDepthScaleBias(
+			                                view.m_clipping_planes);
 
 		// Update the light buffer.
 		m_light_buffer.UpdateData(m_device_context, buffer);
 	}
 
-	void XM_CALLCONV LBufferPass
-		::ProcessDirectionalLights(const World& world,
-								   FXMMATRIX world_to_projection) {
+	void LBufferPass::ClusterLights(const RenderView& view) {
+		if (!view.m_settings.UsesGPULightClustering()) {
+			// Assign the lights to the light clusters on the CPU.
+			m_light_clusterer.Cluster(m_omni_light_buffers,
+									  m_spot_light_buffers,
+									  view.m_world_to_camera,
+									  view.m_camera_to_projection,
+									  view.m_clipping_planes);
+
+			// Update the light cluster buffer.
+			m_light_clusters->UpdateData(m_device_context,
+										 m_light_clusterer.GetClusters(),
+										 m_light_clusterer.GetIndices());
+			return;
+		}
+
+		static_assert(SLOT_SRV_OMNI_LIGHTS == SLOT_SRV_DIRECTIONAL_LIGHTS + 1);
+		static_assert(SLOT_SRV_SPOT_LIGHTS == SLOT_SRV_DIRECTIONAL_LIGHTS + 2);
+
+		ID3D11ShaderResourceView* const srvs[] = {
+			&m_directional_lights.Get(),
+			&m_omni_lights.Get(),
+			&m_spot_lights.Get()
+		};
+
+		// Bind constant buffer.
+		Pipeline::CS::BindConstantBuffer(m_device_context,
+										 SLOT_CBUFFER_LIGHTING, &m_light_buffer.Get());
+		// Bind the SRVs.
+		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS,
+							   static_cast< U32 >(std::size(srvs)), srvs);
+		// Bind the UAVs.
+		m_light_clusters->BindBeginClustering(m_device_context);
+		// CS: Bind the compute shader.
+		m_light_clustering_cs->BindShader(m_device_context);
+
+		// Assign the lights to the light clusters on the GPU.
+		Pipeline::Dispatch(m_device_context, LIGHT_CLUSTER_GRID_X,
+											 LIGHT_CLUSTER_GRID_Y,
+											 LIGHT_CLUSTER_GRID_Z);
+
+		// Unbind the UAVs.
+		m_light_clusters->BindEndClustering(m_device_context);
+	}
 
-		AlignedVector< DirectionalLightBuffer > lights;
-		lights.reserve(m_directional_lights.size());
+	template< typename ClassifyT >
+	const LBufferPass::LightChunk LBufferPass
+		::ClassifyLights(std::size_t nb_lights, ClassifyT&& classify) {
 
-		AlignedVector< DirectionalLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_directional_lights.size());
-		m_directional_light_cameras.clear();
+		const auto nb_chunks
+			= (nb_lights + s_light_chunk_size - 1u) / s_light_chunk_size;
+		m_light_classes.resize(nb_lights);
+		m_light_chunks.resize(nb_chunks);
 
-		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, &lights, &sm_lights, world_to_projection]
-		(const DirectionalLight& light) {
+		// Classify the lights and count the lights of each class per chunk.
+		m_job_system.get().ParallelFor(0u, nb_chunks,
+			[this, nb_lights, &classify](std::size_t chunk) {
 
-			if (State::Active != light.GetState()) {
-				return;
+			const auto begin = chunk * s_light_chunk_size;
+			const auto end   = std::min(begin + s_light_chunk_size, nb_lights);
+
+			LightChunk counts = {};
+			for (auto i = begin; i < end; ++i) {
+				const auto light_class = classify(i);
+				m_light_classes[i] = light_class;
+
+				counts.m_nb_lights    += (LightClass::Unshadowed == light_class);
+				counts.m_nb_sm_lights += (LightClass::Shadowed   == light_class);
 			}
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+			m_light_chunks[chunk] = counts;
+		}, 1u);
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
+		// Convert the counts to the indices of the first lights per chunk.
+		LightChunk total = {};
+		for (auto& chunk : m_light_chunks) {
+			const auto counts = chunk;
+			chunk = total;
+			total.m_nb_lights    += counts.m_nb_lights;
+			total.m_nb_sm_lights += counts.m_nb_sm_lights;
+		}
+
+		return total;
+	}
+
+	template< typename PackT >
+	void LBufferPass::PackLights(std::size_t nb_lights, PackT&& pack) {
+		// Each chunk packs its lights in the ranges reserved by the
+		// classification, which preserves the order of the lights.
+		m_job_system.get().ParallelFor(0u, m_light_chunks.size(),
+			[this, nb_lights, &pack](std::size_t chunk) {
+
+			const auto begin = chunk * s_light_chunk_size;
+			const auto end   = std::min(begin + s_light_chunk_size, nb_lights);
+
+			auto indices = m_light_chunks[chunk];
+			for (auto i = begin; i < end; ++i) {
+				switch (m_light_classes[i]) {
+
+				case LightClass::Unshadowed: {
+					pack(i, false, indices.m_nb_lights++);
+					break;
+				}
+
+				case LightClass::Shadowed: {
+					pack(i, true, indices.m_nb_sm_lights++);
+					break;
+				}
+
+				default: {
+					break;
+				}
+				}
 			}
+		}, 1u);
+	}
 
-			const auto  neg_d               = -transform.GetWorldAxisZ();
-			const auto world_to_light       = transform.GetWorldToObjectMatrix();
-			const auto light_to_lprojection = light.GetLightToProjectionMatrix();
-			const auto world_to_lprojection = world_to_light * light_to_lprojection;
+	void LBufferPass::ProcessDirectionalLights(const RenderFrame& frame,
+											   const RenderView& view) {
 
-			// Create a directional light buffer.
-			DirectionalLightBuffer buffer;
-			buffer.m_neg_d_world = Direction3(XMStore< F32x3 >(neg_d));
-			buffer.m_E_ortho     = light.GetIrradianceSpectrum();
-			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
+		const auto& lights              = frame.GetDirectionalLights();
+		const auto& world_to_projection = view.m_world_to_projection;
+
+		// Cull the directional lights against the view frustum.
+		const auto total = ClassifyLights(lights.size(),
+			[&lights, &world_to_projection](std::size_t i) noexcept {
+
+			const auto& light = lights[i];
+			const auto light_to_projection
+				= light.m_light_to_world * world_to_projection;
+
+			if (BoundingFrustum::Cull(light_to_projection, light.m_aabb)) {
+				return LightClass::Culled;
+			}
+
+			return light.m_shadows ? LightClass::Shadowed
+								   : LightClass::Unshadowed;
+		});
 
-			if (light.UseShadows()) {
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light      = world_to_light;
-				camera.light_to_projection = light_to_lprojection;
+		m_directional_light_buffers.resize(total.m_nb_lights);
+		m_sm_directional_light_buffers.resize(total.m_nb_sm_lights);
+		m_directional_light_cameras.resize(SHADOW_CASCADE_COUNT
+										   * total.m_nb_sm_lights);
 
-				// Add directional light camera to the directional cameras.
-				m_directional_light_cameras.push_back(std::move(camera));
+		// Pack the directional light buffers.
+		PackLights(lights.size(),
+			[this, &lights, &view](std::size_t i, bool shadows,
+								   std::size_t index) noexcept {
 
-				// Add directional light buffer to directional light buffers.
-				sm_lights.push_back(std::move(buffer));
+			const auto& light = lights[i];
+			const auto world_to_lprojection
+				= light.m_world_to_light * light.m_light_to_projection;
+
+			auto& buffer = shadows ? m_sm_directional_light_buffers[index]
+								   : m_directional_light_buffers[index];
+			buffer.m_neg_d_world = light.m_neg_d_world;
+			buffer.m_E_ortho     = light.m_E_ortho;
+			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
+
+			if (!shadows) {
+				return;
 			}
-			else {
-				// Add directional light buffer to directional light buffers.
-				lights.push_back(std::move(buffer));
+
+			// Fit the shadow cascades to the view frustum of the camera.
+			ShadowCascade cascades[SHADOW_CASCADE_COUNT];
+			FitShadowCascades(light.m_light_to_world,
+							  view.m_world_to_camera,
+							  view.m_camera_to_projection,
+							  light.m_aabb,
+							  view.m_clipping_planes,
+							  s_directional_sm_resolution,
+							  cascades);
+
+			auto& sm_buffer = m_sm_directional_light_buffers[index];
+			const auto cameras
+				= &m_directional_light_cameras[SHADOW_CASCADE_COUNT * index];
+			for (std::size_t j = 0u; j < SHADOW_CASCADE_COUNT; ++j) {
+				const auto& cascade = cascades[j];
+				cameras[j].world_to_light      = cascade.m_world_to_light;
+				cameras[j].light_to_projection = cascade.m_light_to_projection;
+				sm_buffer.m_cascade_world_to_projections[j] = XMMatrixTranspose(
+					cascade.m_world_to_light * cascade.m_light_to_projection);
 			}
 		});
 
 		// Update the buffers for directional lights.
-		m_directional_lights.UpdateData(m_device_context, lights);
-		m_sm_directional_lights.UpdateData(m_device_context, sm_lights);
+		m_directional_lights.UpdateData(m_device_context,
+										m_directional_light_buffers);
+		m_sm_directional_lights.UpdateData(m_device_context,
+										   m_sm_directional_light_buffers);
 	}
 
 	void XM_CALLCONV LBufferPass
-		::ProcessOmniLights(const World& world,
+		::ProcessOmniLights(const RenderFrame& frame,
 							FXMMATRIX world_to_projection) {
 
-		AlignedVector< OmniLightBuffer > lights;
-		lights.reserve(m_omni_lights.size());
+		static const XMMATRIX rotations[6] = {
+			XMMatrixRotationY(-XM_PIDIV2), // Look: +x
+			XMMatrixRotationY(XM_PIDIV2),  // Look: -x
+			XMMatrixRotationX(XM_PIDIV2),  // Look: +y
+			XMMatrixRotationX(-XM_PIDIV2), // Look: -y
+			XMMatrixIdentity(),            // Look: +z
+			XMMatrixRotationY(XM_PI),      // Look: -z
+		};
 
-		AlignedVector< ShadowMappedOmniLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_omni_lights.size());
-		m_omni_light_cameras.clear();
+		const auto& lights = frame.GetOmniLights();
 
-		// Process the omni lights.
-		world.ForEach< OmniLight >([this, &lights, &sm_lights, world_to_projection]
-		(const OmniLight& light) {
+		// Cull the omni lights against the view frustum.
+		const auto total = ClassifyLights(lights.size(),
+			[&lights, &world_to_projection](std::size_t i) noexcept {
 
-			static const XMMATRIX rotations[6] = {
-				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
-				XMMatrixRotationY(XM_PIDIV2),  // Look: -x
-				XMMatrixRotationX(XM_PIDIV2),  // Look: +y
-				XMMatrixRotationX(-XM_PIDIV2), // Look: -y
-				XMMatrixIdentity(),            // Look: +z
-				XMMatrixRotationY(XM_PI),      // Look: -z
-			};
+			const auto& light = lights[i];
+			const auto light_to_projection
+				= light.m_light_to_world * world_to_projection;
 
-			if (State::Active != light.GetState()) {
-				return;
+			if (BoundingFrustum::Cull(light_to_projection, light.m_sphere)) {
+				return LightClass::Culled;
 			}
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetBoundingSphere())) {
-				return;
-			}
+			return light.m_shadows ? LightClass::Shadowed
+								   : LightClass::Unshadowed;
+		});
 
-			const auto p     = transform.GetWorldOrigin();
-			const auto range = light.GetWorldRange();
+		m_omni_light_buffers.resize(total.m_nb_lights);
+		m_sm_omni_light_buffers.resize(total.m_nb_sm_lights);
+		m_omni_light_cameras.resize(std::size(rotations) * total.m_nb_sm_lights);
 
-			if (light.UseShadows()) {
-				// Create six omni light cameras.
-				const auto world_to_light       = transform.GetWorldToObjectMatrix();
-				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
+		// Pack the omni light buffers.
+		PackLights(lights.size(),
+			[this, &lights](std::size_t i, bool shadows,
+							std::size_t index) noexcept {
 
-				for (std::size_t i = 0u; i < std::size(rotations); ++i) {
-					LightCameraInfo camera;
-					camera.world_to_light      = world_to_light * rotations[i];
-					camera.light_to_projection = light_to_lprojection;
+			const auto& light = lights[i];
+			const auto inv_sqr_range = 1.0f / (light.m_range * light.m_range);
 
-					// Add omni light camera to the omni light cameras.
-					m_omni_light_cameras.push_back(std::move(camera));
-				}
-
-				// Create an omni light buffer.
-				ShadowMappedOmniLightBuffer buffer;
-				buffer.m_p_world           = Point3(XMStore< F32x3 >(p));
-				buffer.m_inv_sqr_range     = 1.0f / (range * range);
-				buffer.m_I                 = light.GetIntensitySpectrum();
-				buffer.m_world_to_light    = XMMatrixTranspose(world_to_light);
-				buffer.m_projection_values = XMStore< F32x2 >(GetNDCZConstructionValues(
-					                                          light_to_lprojection));
-
-				// Add omni light buffer to omni light buffers.
-				sm_lights.push_back(std::move(buffer));
+			if (!shadows) {
+				auto& buffer = m_omni_light_buffers[index];
+				buffer.m_p_world       = light.m_p_world;
+				buffer.m_inv_sqr_range = inv_sqr_range;
+				buffer.m_I             = light.m_I;
+				return;
 			}
-			else {
-				// Create an omni light buffer.
-				OmniLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-
-				// Add omni light buffer to omni light buffers.
-				lights.push_back(std::move(buffer));
+
+			// Create six omni light cameras.
+			const auto cameras
+				= &m_omni_light_cameras[std::size(rotations) * index];
+			for (std::size_t j = 0u; j < std::size(rotations); ++j) {
+				cameras[j].world_to_light      = light.m_world_to_light
+					                           * rotations[j];
+				cameras[j].light_to_projection = light.m_light_to_projection;
 			}
+
+			auto& buffer = m_sm_omni_light_buffers[index];
+			buffer.m_p_world           = light.m_p_world;
+			buffer.m_inv_sqr_range     = inv_sqr_range;
+			buffer.m_I                 = light.m_I;
+			buffer.m_world_to_light    = XMMatrixTranspose(light.m_world_to_light);
+			buffer.m_projection_values = XMStore< F32x2 >(GetNDCZConstructionValues(
+				                                          light.m_light_to_projection));
 		});
 
 		// Update the buffers for omni lights.
-		m_omni_lights.UpdateData(m_device_context, lights);
-		m_sm_omni_lights.UpdateData(m_device_context, sm_lights);
+		m_omni_lights.UpdateData(m_device_context, m_omni_light_buffers);
+		m_sm_omni_lights.UpdateData(m_device_context, m_sm_omni_light_buffers);
 	}
 
-	void XM_CALLCONV LBufferPass
-		::ProcessSpotLights(const World& world,
-							FXMMATRIX world_to_projection) {
+	void LBufferPass::ProcessSpotLights(const RenderFrame& frame,
+										const RenderView& view) {
 
-		AlignedVector< SpotLightBuffer > lights;
-		lights.reserve(m_spot_lights.size());
+		const auto& lights              = frame.GetSpotLights();
+		const auto& world_to_projection = view.m_world_to_projection;
 
-		AlignedVector< ShadowMappedSpotLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_spot_lights.size());
-		m_spot_light_cameras.clear();
+		// Cull the spotlights against the view frustum.
+		const auto total = ClassifyLights(lights.size(),
+			[&lights, &world_to_projection](std::size_t i) noexcept {
 
-		// Process the spotlights.
-		world.ForEach< SpotLight >([this, &lights, &sm_lights, world_to_projection]
-		(const SpotLight& light) {
+			const auto& light = lights[i];
+			const auto light_to_projection
+				= light.m_light_to_world * world_to_projection;
 
-			if (State::Active != light.GetState()) {
-				return;
+			if (BoundingFrustum::Cull(light_to_projection, light.m_aabb)) {
+				return LightClass::Culled;
 			}
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+			return light.m_shadows ? LightClass::Shadowed
+								   : LightClass::Unshadowed;
+		});
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
+		m_spot_light_buffers.resize(total.m_nb_lights);
+		m_sm_spot_light_buffers.resize(total.m_nb_sm_lights);
+		m_spot_light_cameras.resize(total.m_nb_sm_lights);
+		m_spot_atlas_requests.resize(total.m_nb_sm_lights);
+
+		// Pack the spotlight buffers.
+		PackLights(lights.size(),
+			[this, &lights, &view](std::size_t i, bool shadows,
+								   std::size_t index) noexcept {
+
+			const auto& light = lights[i];
+			const auto inv_sqr_range = 1.0f / (light.m_range * light.m_range);
+
+			if (!shadows) {
+				auto& buffer = m_spot_light_buffers[index];
+				buffer.m_p_world       = light.m_p_world;
+				buffer.m_neg_d_world   = light.m_neg_d_world;
+				buffer.m_inv_sqr_range = inv_sqr_range;
+				buffer.m_I             = light.m_I;
+				buffer.m_cos_umbra     = light.m_cos_umbra;
+				buffer.m_cos_inv_range = light.m_cos_inv_range;
 				return;
 			}
 
-			const auto p     =  transform.GetWorldOrigin();
-			const auto neg_d = -transform.GetWorldAxisZ();
-			const auto range =  light.GetWorldRange();
-
-			if (light.UseShadows()) {
-				const auto world_to_light       = transform.GetWorldToObjectMatrix();
-				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
-				const auto world_to_lprojection = world_to_light * light_to_lprojection;
-
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light          = world_to_light;
-				camera.light_to_projection     = light_to_lprojection;
-
-				// Add spotlight camera to the spotlight cameras.
-				m_spot_light_cameras.push_back(std::move(camera));
-
-				// Create a spotlight buffer.
-				ShadowMappedSpotLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-				buffer.m_cos_umbra     = light.GetEndAngularCutoff();
-				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
-				buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
-
-				// Add spotlight buffer to spotlight buffers.
-				sm_lights.push_back(std::move(buffer));
-			}
-			else {
-				// Create an omni light buffer.
-				SpotLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-				buffer.m_cos_umbra     = light.GetEndAngularCutoff();
-				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
-
-				// Add spotlight buffer to spotlight buffers.
-				lights.push_back(std::move(buffer));
-			}
+			auto& camera = m_spot_light_cameras[index];
+			camera.world_to_light      = light.m_world_to_light;
+			camera.light_to_projection = light.m_light_to_projection;
+
+			const auto world_to_lprojection
+				= light.m_world_to_light * light.m_light_to_projection;
+
+			auto& buffer = m_sm_spot_light_buffers[index];
+			buffer.m_p_world       = light.m_p_world;
+			buffer.m_neg_d_world   = light.m_neg_d_world;
+			buffer.m_inv_sqr_range = inv_sqr_range;
+			buffer.m_I             = light.m_I;
+			buffer.m_cos_umbra     = light.m_cos_umbra;
+			buffer.m_cos_inv_range = light.m_cos_inv_range;
+			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
+
+			// The resolution of the shadow map depends on the screen-space
+			// size of the light volume.
+			auto& request = m_spot_atlas_requests[index];
+			request.m_key        = light.m_guid;
+			request.m_importance = ShadowAtlasPacker::GetImportance(
+				BoundingSphere(XMLoad(light.m_p_world), light.m_range),
+				view.m_world_to_camera, view.m_camera_to_projection);
 		});
 
+		// Pack the shadow maps of the spotlights into the shadow atlas.
+		m_spot_atlas_packer.Pack(m_spot_atlas_requests, m_spot_atlas_tiles);
+
+		const auto inv_resolution = 1.0f / s_spot_atlas_resolution;
+		for (std::size_t i = 0u; i < m_spot_atlas_tiles.size(); ++i) {
+			const auto& tile = m_spot_atlas_tiles[i];
+			m_sm_spot_light_buffers[i].m_shadow_tile = F32x4(
+				tile.m_top_left[0] * inv_resolution,
+				tile.m_top_left[1] * inv_resolution,
+				tile.m_resolution  * inv_resolution,
+				0.0f);
+		}
+
 		// Update the buffers for spotlights.
-		m_spot_lights.UpdateData(m_device_context, lights);
-		m_sm_spot_lights.UpdateData(m_device_context, sm_lights);
+		m_spot_lights.UpdateData(m_device_context, m_spot_light_buffers);
+		m_sm_spot_lights.UpdateData(m_device_context, m_sm_spot_light_buffers);
 	}
 
 	void LBufferPass::SetupShadowMaps() {
-		// Setup the shadow maps for the directional lights.
+		// Setup the shadow maps for the shadow cascades of the directional
+		// lights.
 		{
-			const auto nb_requested = m_sm_directional_lights.size();
+			const auto nb_requested = SHADOW_CASCADE_COUNT
+				                    * m_sm_directional_lights.size();
 			const auto nb_available = m_directional_sms->GetNumberOfShadowMaps();
 
 			if (nb_available < nb_requested) {
 				ComPtr< ID3D11Device > device;
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_directional_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-																  nb_requested);
+					nb_requested,
+					U32x2(s_directional_sm_resolution, s_directional_sm_resolution));
+				m_directional_casters.Reset(m_directional_sms->GetNumberOfShadowMaps());
 			}
-
-			m_directional_sms->ClearDSVs(m_device_context);
 		}
 
 		// Setup the shadow maps for the omni lights.
@@ -391,45 +563,50 @@ namespace mage::rendering {
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_omni_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(),
 															   nb_requested);
+				m_omni_casters.Reset(m_omni_sms->GetNumberOfShadowMaps());
 			}
-
-			m_omni_sms->ClearDSVs(m_device_context);
 		}
 
-		// Setup the shadow maps for the spotlights.
-		{
-			const auto nb_requested = m_sm_spot_lights.size();
-			const auto nb_available = m_spot_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_spot_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-														   nb_requested);
-			}
-
-			m_spot_sms->ClearDSVs(m_device_context);
-		}
+		// Setup the shadow maps for the spotlights. The shadow atlas itself
+		// is never recreated.
+		m_spot_casters.Resize(m_sm_spot_lights.size());
 	}
 
-	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+	void LBufferPass::RenderShadowMaps(const RenderFrame& frame) {
+		const auto& culler = frame.GetModelCuller();
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
-		// Render the shadow maps of the directional lights.
+		// Render the shadow maps of the shadow cascades of the directional
+		// lights.
 		{
 			// Bind the viewport.
 			m_directional_sms->Bind(m_device_context);
 			// Bind the rasterizer state.
 			m_directional_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_directional_light_cameras) {
-				// Bind the DSV.
-				m_directional_sms->BindDSV(m_device_context, i++);
+			for (std::size_t i = 0u; i < m_directional_light_cameras.size(); ++i) {
+				const auto& camera = m_directional_light_cameras[i];
+
+				// Gather the shadow casters against the frustum of the
+				// shadow cascade.
+				m_directional_casters.Gather(i, frame,
+					camera.world_to_light * camera.light_to_projection);
+
+				// Skip the shadow map if neither the light nor its shadow
+				// casters changed.
+				if (!m_directional_casters.IsDirty(i)) {
+					continue;
+				}
+
+				// Clear and bind the DSV.
+				m_directional_sms->ClearDSV(m_device_context, i);
+				m_directional_sms->BindDSV(m_device_context, i);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
+				m_depth_pass->RenderOccluders(culler,
+											  m_directional_casters.GetCasters(i),
 											  camera.world_to_light,
 											  camera.light_to_projection);
 			}
@@ -442,32 +619,88 @@ namespace mage::rendering {
 			// Bind the rasterizer state.
 			m_omni_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_omni_light_cameras) {
-				// Bind the DSV.
-				m_omni_sms->BindDSV(m_device_context, i++);
+			for (std::size_t i = 0u; i < m_sm_omni_light_buffers.size(); ++i) {
+				const auto& light   = m_sm_omni_light_buffers[i];
+				const auto  cameras = &m_omni_light_cameras[6u * i];
 
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				XMMATRIX world_to_projections[6];
+				for (std::size_t j = 0u; j < std::size(world_to_projections); ++j) {
+					world_to_projections[j] = cameras[j].world_to_light
+						                    * cameras[j].light_to_projection;
+				}
+
+				// Gather the shadow casters against the light sphere once, and
+				// against the light frustum of each face.
+				const BoundingSphere sphere(XMLoad(light.m_p_world),
+											1.0f / std::sqrt(light.m_inv_sqr_range));
+				m_omni_casters.GatherCube(6u * i, frame, sphere,
+										  world_to_projections);
+
+				for (std::size_t j = 0u; j < std::size(world_to_projections); ++j) {
+					const auto index = 6u * i + j;
+
+					// Skip the face if neither the light nor its shadow
+					// casters changed.
+					if (!m_omni_casters.IsDirty(index)) {
+						continue;
+					}
+
+					// Clear and bind the DSV.
+					m_omni_sms->ClearDSV(m_device_context, index);
+					m_omni_sms->BindDSV(m_device_context, index);
+
+					// Perform the depth pass.
+					m_depth_pass->RenderOccluders(culler,
+												  m_omni_casters.GetCasters(index),
+												  cameras[j].world_to_light,
+												  cameras[j].light_to_projection);
+				}
 			}
 		}
 
 		// Render the shadow maps of the spotlights.
 		{
-			// Bind the viewport.
-			m_spot_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_spot_sms->BindRasterizerState(m_device_context);
+			// Bind the DSV of the shadow atlas.
+			m_spot_sms->BindDSV(m_device_context, 0u);
+
+			for (std::size_t i = 0u; i < m_spot_light_cameras.size(); ++i) {
+				const auto& tile = m_spot_atlas_tiles[i];
+
+				// Skip the shadow map if it does not fit in the shadow atlas.
+				if (0u == tile.m_resolution) {
+					continue;
+				}
+
+				const auto& camera = m_spot_light_cameras[i];
+
+				// Gather the shadow casters against the light frustum.
+				m_spot_casters.Gather(i, frame,
+					camera.world_to_light * camera.light_to_projection);
+
+				// Skip the shadow map if its tile is retained, and neither
+				// the light nor its shadow casters changed.
+				if (!tile.m_reallocated && !m_spot_casters.IsDirty(i)) {
+					continue;
+				}
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_spot_light_cameras) {
-				// Bind the DSV.
-				m_spot_sms->BindDSV(m_device_context, i++);
+				// Bind the viewport of the tile.
+				const Viewport viewport(D3D11_VIEWPORT{
+					static_cast< F32 >(tile.m_top_left[0]),
+					static_cast< F32 >(tile.m_top_left[1]),
+					static_cast< F32 >(tile.m_resolution),
+					static_cast< F32 >(tile.m_resolution),
+					0.0f,
+					1.0f });
+				viewport.Bind(m_device_context);
+
+				// Clear the tile.
+				m_depth_pass->ClearViewport();
+				// Bind the rasterizer state.
+				m_spot_sms->BindRasterizerState(m_device_context);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
+				m_depth_pass->RenderOccluders(culler,
+											  m_spot_casters.GetCasters(i),
 											  camera.world_to_light,
 											  camera.light_to_projection);
 			}
@@ -8,7 +8,14 @@
 #include "renderer\buffer\structured_buffer.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 #include "renderer\buffer\shadow_map_buffer.hpp"
+#include "renderer\buffer\light_cluster_buffer.hpp"
 #include "renderer\pass\depth_pass.hpp"
+#include "renderer\render_frame.hpp"
+#include "renderer\light_clusterer.hpp"
+#include "renderer\shadow_caster_cache.hpp"
+#include "renderer\shadow_atlas_packer.hpp"
+#include "renderer\shadow_cascades.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -36,11 +43,14 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in,out]	resource_manager
 						A reference to the resource manager.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager);
+							 ResourceManager& resource_manager,
+							 JobSystem& job_system);
 		LBufferPass(const LBufferPass& buffer) = delete;
 		LBufferPass(LBufferPass&& buffer) noexcept;
 		~LBufferPass();
@@ -56,11 +66,61 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection);
+		void Render(const RenderFrame& frame, const RenderView& view);
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the classes of processed lights.
+		 */
+		enum class LightClass : U8 {
+			Culled = 0,
+			Unshadowed,
+			Shadowed
+		};
+
+		/**
+		 A struct of chunks of processed lights.
+		 */
+		struct LightChunk {
+
+			/**
+			 The number of (or the index of the first) unshadowed lights of
+			 this light chunk.
+			 */
+			U32 m_nb_lights;
+
+			/**
+			 The number of (or the index of the first) shadowed lights of
+			 this light chunk.
+			 */
+			U32 m_nb_sm_lights;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of lights per chunk processed by a single job.
+		 */
+		static constexpr std::size_t s_light_chunk_size = 256u;
+
+		/**
+		 The resolution of the shadow maps of the shadow cascades of the
+		 directional lights.
+		 */
+		static constexpr U32 s_directional_sm_resolution = 2048u;
+
+		/**
+		 The resolution of the shadow atlas of the spotlights.
+		 */
+		static constexpr U32 s_spot_atlas_resolution = 4096u;
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -68,18 +128,24 @@ namespace mage::rendering {
 		void UnbindShadowMaps() const noexcept;
 		void BindLBuffer() const noexcept;
 
-		void ProcessLightsData(const World& world);
+		void ProcessLightsData(const RenderFrame& frame, const RenderView& view);
+		void ClusterLights(const RenderView& view);
 
-		void XM_CALLCONV ProcessDirectionalLights(const World& world,
-												  FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessOmniLights(const World& world,
-										   FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessSpotLights(const World& world,
+		void ProcessDirectionalLights(const RenderFrame& frame,
+									  const RenderView& view);
+		void XM_CALLCONV ProcessOmniLights(const RenderFrame& frame,
 										   FXMMATRIX world_to_projection);
+		void ProcessSpotLights(const RenderFrame& frame, const RenderView& view);
+
+		template< typename ClassifyT >
+		const LightChunk ClassifyLights(std::size_t nb_lights,
+										ClassifyT&& classify);
+		template< typename PackT >
+		void PackLights(std::size_t nb_lights, PackT&& pack);
 
 		void SetupShadowMaps();
 
-		void XM_CALLCONV RenderShadowMaps(const World& world);
+		void RenderShadowMaps(const RenderFrame& frame);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -90,11 +156,16 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ID3D11DeviceContext > m_device_context;
 
+		/**
+		 A reference to the job system of this LBuffer pass.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		ConstantBuffer< LightBuffer > m_light_buffer;
 		StructuredBuffer< DirectionalLightBuffer > m_directional_lights;
 		StructuredBuffer< OmniLightBuffer > m_omni_lights;
 		StructuredBuffer< SpotLightBuffer > m_spot_lights;
-		StructuredBuffer< DirectionalLightBuffer > m_sm_directional_lights;
+		StructuredBuffer< ShadowMappedDirectionalLightBuffer > m_sm_directional_lights;
 		StructuredBuffer< ShadowMappedOmniLightBuffer > m_sm_omni_lights;
 		StructuredBuffer< ShadowMappedSpotLightBuffer > m_sm_spot_lights;
 
@@ -102,6 +173,44 @@ namespace mage::rendering {
 		UniquePtr< ShadowCubeMapBuffer > m_omni_sms;
 		UniquePtr< ShadowMapBuffer > m_spot_sms;
 
+		/**
+		 The shadow caster caches of the shadow maps of the directional
+		 lights, omni lights and spotlights of this LBuffer pass.
+		 */
+		ShadowCasterCache m_directional_casters;
+		ShadowCasterCache m_omni_casters;
+		ShadowCasterCache m_spot_casters;
+
+		/**
+		 The shadow atlas packer of this LBuffer pass packing the shadow maps
+		 of the spotlights into a single shadow atlas.
+		 */
+		ShadowAtlasPacker m_spot_atlas_packer;
+
+		/**
+		 The shadow atlas requests and tiles of the shadow mapped spotlights
+		 which are currently processed by this LBuffer pass.
+		 */
+		std::vector< ShadowAtlasRequest > m_spot_atlas_requests;
+		std::vector< ShadowAtlasTile > m_spot_atlas_tiles;
+
+		/**
+		 A pointer to the light cluster buffer of this LBuffer pass.
+		 */
+		UniquePtr< LightClusterBuffer > m_light_clusters;
+
+		/**
+		 The light clusterer of this LBuffer pass assigning the lights to the
+		 light clusters on the CPU.
+		 */
+		LightClusterer m_light_clusterer;
+
+		/**
+		 A pointer to the compute shader of this LBuffer pass assigning the
+		 lights to the light clusters on the GPU.
+		 */
+		ComputeShaderPtr m_light_clustering_cs;
+
 		struct alignas(16) LightCameraInfo {
 			XMMATRIX world_to_light;
 			XMMATRIX light_to_projection;
@@ -111,6 +220,29 @@ namespace mage::rendering {
 		AlignedVector< LightCameraInfo > m_omni_light_cameras;
 		AlignedVector< LightCameraInfo > m_spot_light_cameras;
 
+		/**
+		 The light buffers packed by this LBuffer pass. These are retained
+		 between frames to reuse their capacity.
+		 */
+		AlignedVector< DirectionalLightBuffer > m_directional_light_buffers;
+		AlignedVector< OmniLightBuffer > m_omni_light_buffers;
+		AlignedVector< SpotLightBuffer > m_spot_light_buffers;
+		AlignedVector< ShadowMappedDirectionalLightBuffer > m_sm_directional_light_buffers;
+		AlignedVector< ShadowMappedOmniLightBuffer > m_sm_omni_light_buffers;
+		AlignedVector< ShadowMappedSpotLightBuffer > m_sm_spot_light_buffers;
+
+		/**
+		 The classes of the lights which are currently processed by this
+		 LBuffer pass.
+		 */
+		std::vector< LightClass > m_light_classes;
+
+		/**
+		 The chunks of the lights which are currently processed by this
+		 LBuffer pass.
+		 */
+		std::vector< LightChunk > m_light_chunks;
+
 		UniquePtr< DepthPass > m_depth_pass;
 	};
 }
\ No newline at end of file
@@ -28,6 +28,9 @@ namespace mage::rendering {
 		m_vs(CreateVoxelizationVS(resource_manager)),
 		m_gs(CreateVoxelizationGS(resource_manager)),
 		m_cs(CreateVoxelizationCS(resource_manager)),
+		m_emissive_ps(CreateVoxelizationEmissivePS(resource_manager)),
+		m_ps(CreateVoxelizationPS(resource_manager, false)),
+		m_tsnm_ps(CreateVoxelizationPS(resource_manager, true)),
 		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)) {
 
 		SetupRasterizerState(device);
@@ -94,13 +97,13 @@ namespace mage::rendering {
 								   BlendStateID::Opaque);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection,
-											  std::size_t resolution) {
+	void VoxelizationPass::Render(const ModelCuller& culler,
+								  const VisibilityMask& visibility,
+								  std::size_t resolution) {
 		SetupVoxelGrid(resolution);
 
 		m_voxel_grid->BindBeginVoxelizationBuffer(m_device_context);
-		Render(world, world_to_projection);
+		Render(culler, visibility);
 		m_voxel_grid->BindEndVoxelizationBuffer(m_device_context);
 
 		m_voxel_grid->BindBeginVoxelizationTexture(m_device_context);
@@ -108,8 +111,8 @@ namespace mage::rendering {
 		m_voxel_grid->BindEndVoxelizationTexture(m_device_context);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void VoxelizationPass::Render(const ModelCuller& culler,
+								  const VisibilityMask& visibility) const {
 		// Bind the fixed opaque state.
 		BindFixedState();
 
@@ -118,14 +121,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// All emissive models.
 		//---------------------------------------------------------------------
-		{
-			const PixelShaderPtr ps = CreateVoxelizationEmissivePS(m_resource_manager);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
+		// PS: Bind the pixel shader.
+		m_emissive_ps->BindShader(m_device_context);
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		culler.ForEach(visibility, [this](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
@@ -135,22 +135,17 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model);
 		});
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
+		// PS: Bind the pixel shader.
+		m_ps->BindShader(m_device_context);
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		culler.ForEach(visibility, [this](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
@@ -161,22 +156,17 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model);
 		});
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
+		// PS: Bind the pixel shader.
+		m_tsnm_ps->BindShader(m_device_context);
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+		culler.ForEach(visibility, [this](const Model& model) {
 
 			const auto& material = model.GetMaterial();
 
@@ -187,27 +177,16 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model);
 		});
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const Model& model,
-											  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
-		const auto& material             = model.GetMaterial();
+	void VoxelizationPass::Render(const Model& model) const noexcept {
+		const auto& material = model.GetMaterial();
 
 		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::VS >(SLOT_CBUFFER_MODEL);
+		model.BindBuffer< Pipeline::PS >(SLOT_CBUFFER_MODEL);
 		// Bind the SRVs of the model.
 		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
 		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
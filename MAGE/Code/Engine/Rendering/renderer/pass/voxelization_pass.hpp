@@ -6,9 +6,9 @@
 #pragma region
 
 #include "renderer\buffer\voxel_grid.hpp"
+#include "renderer\model_culler.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
 
 #pragma endregion
 
@@ -98,20 +98,21 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the world.
+		 Renders the visible models.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		culler
+						A reference to the model culler.
+		 @param[in]		visibility
+						A reference to the visibility mask of the models of
+						the given model culler.
 		 @param[in]		resolution
 						The resolution of the regular voxel grid.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection,
-								std::size_t resolution);
+		void Render(const ModelCuller& culler,
+					const VisibilityMask& visibility,
+					std::size_t resolution);
 
 	private:
 
@@ -137,28 +138,26 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the given world.
+		 Renders the visible models.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		culler
+						A reference to the model culler.
+		 @param[in]		visibility
+						A reference to the visibility mask of the models of
+						the given model culler.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection) const;
+		void Render(const ModelCuller& culler,
+					const VisibilityMask& visibility) const;
 
 		/**
 		 Renders the given model.
 
 		 @param[in]		model
 						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const Model& model) const noexcept;
 
 		/**
 		 Dispatches this voxelization pass.
@@ -204,6 +203,22 @@ namespace mage::rendering {
 		 */
 		ComputeShaderPtr m_cs;
 
+		/**
+		 A pointer to the emissive pixel shader of this voxelization pass.
+		 */
+		PixelShaderPtr m_emissive_ps;
+
+		/**
+		 A pointer to the pixel shader of this voxelization pass.
+		 */
+		PixelShaderPtr m_ps;
+
+		/**
+		 A pointer to the tangent space normal mapping pixel shader of this
+		 voxelization pass.
+		 */
+		PixelShaderPtr m_tsnm_ps;
+
 		/**
 		 The voxel grid of this voxelization pass.
 		 */
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
+#include "renderer\binding_cache.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -195,6 +196,40 @@ namespace mage::rendering {
 			CS::BindConstantBuffer(device_context, slot, buffer);
 		}
 
+		/**
+		 Binds a range of a constant buffer to all shader stages.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @pre			@a first_constant and @a nb_constants are multiples of
+						16.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+		 @param[in]		buffer
+						A pointer to the constant buffer.
+		 @param[in]		first_constant
+						The offset of the range in shader constants (i.e. 16
+						bytes).
+		 @param[in]		nb_constants
+						The number of shader constants of the range.
+		 */
+		static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+			                           U32 slot,
+			                           ID3D11Buffer* buffer,
+			                           U32 first_constant,
+			                           U32 nb_constants) noexcept {
+
+			VS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+			HS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+			DS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+			GS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+			PS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+			CS::BindConstantBuffer(device_context, slot, buffer, first_constant, nb_constants);
+		}
+
 		/**
 		 Binds an array of constant buffers to all shader stages.
 
@@ -407,13 +442,20 @@ namespace mage::rendering {
 			static void BindPrimitiveTopology(ID3D11DeviceContext& device_context,
 				                              D3D11_PRIMITIVE_TOPOLOGY topology) noexcept {
 
-				device_context.IASetPrimitiveTopology(topology);
+				BindCached(s_bindings.m_topology, 0u, 1u, &topology,
+					[&device_context](U32, U32, const D3D11_PRIMITIVE_TOPOLOGY* topologies) {
+						device_context.IASetPrimitiveTopology(*topologies);
+					});
 			}
 
 			static void BindInputLayout(ID3D11DeviceContext& device_context,
 				                        ID3D11InputLayout& input_layout) noexcept {
 
-				device_context.IASetInputLayout(&input_layout);
+				ID3D11InputLayout* const input_layouts[] = { &input_layout };
+				BindCached(s_bindings.m_input_layout, 0u, 1u, input_layouts,
+					[&device_context](U32, U32, ID3D11InputLayout* const* values) {
+						device_context.IASetInputLayout(*values);
+					});
 			}
 		};
 
@@ -466,9 +508,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.VSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_vs.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11VertexShader* const* shaders) {
+							device_context.VSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_vs.m_shader.Invalidate();
+					OnBind();
+					device_context.VSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -518,7 +570,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.VSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_vs.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.VSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the vertex shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_vs.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.VSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -569,7 +660,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.VSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_vs.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.VSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -619,7 +714,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.VSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_vs.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.VSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -672,9 +770,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.HSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_hs.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11HullShader* const* shaders) {
+							device_context.HSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_hs.m_shader.Invalidate();
+					OnBind();
+					device_context.HSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -724,7 +832,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.HSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_hs.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.HSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the hull shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_hs.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.HSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -775,7 +922,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.HSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_hs.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.HSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -825,7 +976,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.HSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_hs.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.HSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -890,9 +1044,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.DSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_ds.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11DomainShader* const* shaders) {
+							device_context.DSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_ds.m_shader.Invalidate();
+					OnBind();
+					device_context.DSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -942,7 +1106,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.DSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_ds.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.DSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the domain shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_ds.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.DSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -993,7 +1196,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.DSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_ds.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.DSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -1043,7 +1250,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.DSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_ds.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.DSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -1096,9 +1306,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.GSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_gs.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11GeometryShader* const* shaders) {
+							device_context.GSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_gs.m_shader.Invalidate();
+					OnBind();
+					device_context.GSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -1148,7 +1368,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.GSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_gs.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.GSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the geometry shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_gs.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.GSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -1199,7 +1458,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.GSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_gs.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.GSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -1249,7 +1512,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.GSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_gs.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.GSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -1299,7 +1565,10 @@ namespace mage::rendering {
 			static void BindState(ID3D11DeviceContext& device_context,
 				                  ID3D11RasterizerState* state) noexcept {
 
-				device_context.RSSetState(state);
+				BindCached(s_bindings.m_rasterizer_state, 0u, 1u, &state,
+					[&device_context](U32, U32, ID3D11RasterizerState* const* states) {
+						device_context.RSSetState(*states);
+					});
 			}
 
 			static void GetBoundViewports(ID3D11DeviceContext& device_context,
@@ -1372,9 +1641,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.PSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_ps.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11PixelShader* const* shaders) {
+							device_context.PSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_ps.m_shader.Invalidate();
+					OnBind();
+					device_context.PSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -1424,7 +1703,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.PSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_ps.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.PSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the pixel shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_ps.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.PSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -1475,7 +1793,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.PSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_ps.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.PSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -1525,7 +1847,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.PSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_ps.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.PSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -1551,7 +1876,17 @@ namespace mage::rendering {
 				                              ID3D11DepthStencilState* state,
 				                              U32 stencil_ref = 0u) noexcept {
 
-				device_context.OMSetDepthStencilState(state, stencil_ref);
+				if (0u == stencil_ref) {
+					BindCached(s_bindings.m_depth_stencil_state, 0u, 1u, &state,
+						[&device_context](U32, U32, ID3D11DepthStencilState* const* states) {
+							device_context.OMSetDepthStencilState(*states, 0u);
+						});
+				}
+				else {
+					s_bindings.m_depth_stencil_state.Invalidate();
+					OnBind();
+					device_context.OMSetDepthStencilState(state, stencil_ref);
+				}
 			}
 
 			static void BindBlendState(ID3D11DeviceContext& device_context,
@@ -1566,7 +1901,17 @@ namespace mage::rendering {
 				                       const F32 blend_factor[4],
 				                       U32 sample_mask = 0xffffffff) noexcept {
 
-				device_context.OMSetBlendState(state, blend_factor, sample_mask);
+				if (nullptr == blend_factor && 0xffffffff == sample_mask) {
+					BindCached(s_bindings.m_blend_state, 0u, 1u, &state,
+						[&device_context](U32, U32, ID3D11BlendState* const* states) {
+							device_context.OMSetBlendState(*states, nullptr, 0xffffffff);
+						});
+				}
+				else {
+					s_bindings.m_blend_state.Invalidate();
+					OnBind();
+					device_context.OMSetBlendState(state, blend_factor, sample_mask);
+				}
 			}
 
 			static void BindRTVAndDSV(ID3D11DeviceContext& device_context,
@@ -1587,6 +1932,7 @@ namespace mage::rendering {
 				                       ID3D11DepthStencilView* dsv) noexcept {
 
 				device_context.OMSetRenderTargets(nb_views, rtvs, dsv);
+				OnBindOutputs();
 			}
 
 			static void BindRTVAndDSVAndUAV(ID3D11DeviceContext& device_context,
@@ -1657,6 +2003,7 @@ namespace mage::rendering {
 
 				device_context.OMSetRenderTargetsAndUnorderedAccessViews(
 					nb_views, rtvs, dsv, uav_slot, nb_uavs, uavs, initial_counts);
+				OnBindOutputs();
 			}
 
 			static void ClearRTV(ID3D11DeviceContext& device_context,
@@ -1761,9 +2108,19 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances,
 				                   U32 nb_class_instances) noexcept {
 
-				device_context.CSSetShader(shader,
+				if (0u == nb_class_instances) {
+					BindCached(s_bindings.m_cs.m_shader, 0u, 1u, &shader,
+						[&device_context](U32, U32, ID3D11ComputeShader* const* shaders) {
+							device_context.CSSetShader(*shaders, nullptr, 0u);
+						});
+				}
+				else {
+					s_bindings.m_cs.m_shader.Invalidate();
+					OnBind();
+					device_context.CSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				}
 			}
 
 			/**
@@ -1813,7 +2170,46 @@ namespace mage::rendering {
 				                            U32 nb_buffers,
 				                            ID3D11Buffer* const* buffers) noexcept {
 
-				device_context.CSSetConstantBuffers(slot, nb_buffers, buffers);
+				BindCached(s_bindings.m_cs.m_cbuffers, slot, nb_buffers, buffers,
+					[&device_context](U32 first, U32 count, ID3D11Buffer* const* values) {
+						device_context.CSSetConstantBuffers(first, count, values);
+					});
+			}
+
+			/**
+			 Binds a range of a constant buffer to the compute shader stage.
+
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples of
+							16.
+			 @param[in,out]	device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set
+							the constant buffer to (ranges from 0 to
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the range in shader constants (i.e.
+							16 bytes).
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot,
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+
+				const ConstantBufferBinding binding(buffer, first_constant, nb_constants);
+				BindCached(s_bindings.m_cs.m_cbuffers, slot, 1u, &binding,
+					[&device_context, buffer, first_constant, nb_constants]
+					(U32 first, U32, const ConstantBufferBinding*) {
+						device_context.CSSetConstantBuffers1(first, 1u, &buffer,
+															 &first_constant,
+															 &nb_constants);
+					});
 			}
 
 			/**
@@ -1864,7 +2260,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs,
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
-				device_context.CSSetShaderResources(slot, nb_srvs, srvs);
+				BindCached(s_bindings.m_cs.m_srvs, slot, nb_srvs, srvs,
+					[&device_context](U32 first, U32 count,
+					                  ID3D11ShaderResourceView* const* values) {
+						device_context.CSSetShaderResources(first, count, values);
+					});
 			}
 
 			/**
@@ -1928,6 +2328,7 @@ namespace mage::rendering {
 														 nb_uavs,
 														 uavs,
 														 initial_counts);
+				OnBindOutputs();
 			}
 
 			/**
@@ -1977,7 +2378,10 @@ namespace mage::rendering {
 				                     U32 nb_samplers,
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
-				device_context.CSSetSamplers(slot, nb_samplers, samplers);
+				BindCached(s_bindings.m_cs.m_samplers, slot, nb_samplers, samplers,
+					[&device_context](U32 first, U32 count, ID3D11SamplerState* const* values) {
+						device_context.CSSetSamplers(first, count, values);
+					});
 			}
 		};
 
@@ -2000,8 +2404,173 @@ namespace mage::rendering {
 		 */
 		static U32 s_nb_draws;
 
+		/**
+		 The number of issued bind calls of shadowed bindings.
+		 */
+		static U32 s_nb_binds;
+
+		/**
+		 The number of elided (i.e. redundant) bind calls.
+		 */
+		static U32 s_nb_elided_binds;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: Bindings
+		//---------------------------------------------------------------------
+
+		/**
+		 Invalidates the shadowed bindings of the pipeline.
+
+		 This must be called after the state of the device context is
+		 changed without passing through the pipeline (e.g., by clearing the
+		 state of the device context or by third-party rendering code).
+		 */
+		static void InvalidateBindings() noexcept {
+			s_bindings = Bindings();
+		}
+
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shadowed constant buffer bindings.
+		 */
+		struct ConstantBufferBinding {
+
+			/**
+			 Constructs a constant buffer binding.
+
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset of the bound range in shader constants.
+			 @param[in]		nb_constants
+							The number of shader constants of the bound range.
+							Zero denotes the complete constant buffer.
+			 */
+			constexpr ConstantBufferBinding(const void* buffer = nullptr,
+											U32 first_constant = 0u,
+											U32 nb_constants = 0u) noexcept
+				: m_buffer(buffer),
+				m_first_constant(first_constant),
+				m_nb_constants(nb_constants) {}
+
+			[[nodiscard]]
+			constexpr bool operator!=(const ConstantBufferBinding& rhs) const noexcept {
+				return m_buffer         != rhs.m_buffer
+					|| m_first_constant != rhs.m_first_constant
+					|| m_nb_constants   != rhs.m_nb_constants;
+			}
+
+			/**
+			 A pointer to the bound constant buffer.
+			 */
+			const void* m_buffer;
+
+			/**
+			 The offset of the bound range in shader constants.
+			 */
+			U32 m_first_constant;
+
+			/**
+			 The number of shader constants of the bound range.
+			 */
+			U32 m_nb_constants;
+		};
+
+		/**
+		 A struct of shadowed bindings of a shader stage.
+		 */
+		struct StageBindings {
+
+			/**
+			 The shadowed shader of the shader stage.
+			 */
+			BindingCache< const void*, 1u > m_shader;
+
+			/**
+			 The shadowed constant buffers of the shader stage.
+			 */
+			BindingCache< ConstantBufferBinding,
+				D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT > m_cbuffers;
+
+			/**
+			 The shadowed shader resource views of the shader stage. Only the
+			 lower 64 slots are shadowed.
+			 */
+			BindingCache< const void*, 64u > m_srvs;
+
+			/**
+			 The shadowed samplers of the shader stage.
+			 */
+			BindingCache< const void*,
+				D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT > m_samplers;
+		};
+
+		/**
+		 A struct of shadowed bindings of the pipeline.
+		 */
+		struct Bindings {
+
+			/**
+			 The shadowed primitive topology of the input assembler stage.
+			 */
+			BindingCache< D3D11_PRIMITIVE_TOPOLOGY, 1u > m_topology;
+
+			/**
+			 The shadowed input layout of the input assembler stage.
+			 */
+			BindingCache< const void*, 1u > m_input_layout;
+
+			/**
+			 The shadowed bindings of the vertex shader stage.
+			 */
+			StageBindings m_vs;
+
+			/**
+			 The shadowed bindings of the hull shader stage.
+			 */
+			StageBindings m_hs;
+
+			/**
+			 The shadowed bindings of the domain shader stage.
+			 */
+			StageBindings m_ds;
+
+			/**
+			 The shadowed bindings of the geometry shader stage.
+			 */
+			StageBindings m_gs;
+
+			/**
+			 The shadowed rasterizer state of the rasterizer stage.
+			 */
+			BindingCache< const void*, 1u > m_rasterizer_state;
+
+			/**
+			 The shadowed bindings of the pixel shader stage.
+			 */
+			StageBindings m_ps;
+
+			/**
+			 The shadowed depth-stencil state of the output merger stage.
+			 */
+			BindingCache< const void*, 1u > m_depth_stencil_state;
+
+			/**
+			 The shadowed blend state of the output merger stage.
+			 */
+			BindingCache< const void*, 1u > m_blend_state;
+
+			/**
+			 The shadowed bindings of the compute shader stage.
+			 */
+			StageBindings m_cs;
+		};
+
 		//---------------------------------------------------------------------
 		// Class Member Methods
 		//---------------------------------------------------------------------
@@ -2009,6 +2578,47 @@ namespace mage::rendering {
 		static void OnDraw() noexcept {
 			++s_nb_draws;
 		}
+
+		static void OnBind() noexcept {
+			++s_nb_binds;
+		}
+
+		static void OnBindOutputs() noexcept {
+			// Binding a resource as output unbinds all its shader resource
+			// views from all shader stages.
+			s_bindings.m_vs.m_srvs.Invalidate();
+			s_bindings.m_hs.m_srvs.Invalidate();
+			s_bindings.m_ds.m_srvs.Invalidate();
+			s_bindings.m_gs.m_srvs.Invalidate();
+			s_bindings.m_ps.m_srvs.Invalidate();
+			s_bindings.m_cs.m_srvs.Invalidate();
+		}
+
+		template< typename CacheT, typename T, typename BindT >
+		static void BindCached(CacheT& cache,
+							   U32 slot,
+							   U32 nb_values,
+							   const T* values,
+							   BindT&& bind) noexcept {
+
+			const auto [first, count] = cache.Update(slot, nb_values, values);
+			if (0u == count) {
+				++s_nb_elided_binds;
+				return;
+			}
+
+			OnBind();
+			bind(first, count, values + (first - slot));
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shadowed bindings of the pipeline.
+		 */
+		static Bindings s_bindings;
 	};
 
 	/**
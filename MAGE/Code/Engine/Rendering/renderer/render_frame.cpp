@@ -0,0 +1,214 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\render_frame.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Combines the given hash value with the given value.
+
+		 @param[in]		seed
+						The hash value.
+		 @param[in]		value
+						The value.
+		 @return		The combined hash value.
+		 */
+		[[nodiscard]]
+		constexpr U64 HashCombine(U64 seed, U64 value) noexcept {
+			return seed ^ (value + 0x9E3779B97F4A7C15ull
+						   + (seed << 6u) + (seed >> 2u));
+		}
+	}
+
+	RenderFrame::RenderFrame()
+		: m_model_culler(),
+		m_model_classifications(),
+		m_model_versions(),
+		m_models_version(0u),
+		m_model_buffers(),
+		m_ambient_light(),
+		m_directional_lights(),
+		m_omni_lights(),
+		m_spot_lights(),
+		m_views(),
+		m_world_version(0u) {}
+
+	RenderFrame::RenderFrame(RenderFrame&& frame) noexcept = default;
+
+	RenderFrame::~RenderFrame() = default;
+
+	RenderFrame& RenderFrame::operator=(RenderFrame&& frame) noexcept = default;
+
+	void RenderFrame::Extract(const World& world, AntiAliasing aa) {
+		m_world_version = world.GetVersion();
+
+		ExtractModels(world);
+		ExtractLights(world);
+		ExtractViews(world, aa);
+	}
+
+	void RenderFrame::ExtractModels(const World& world) {
+		m_model_culler.Gather(world);
+
+		const auto nb_models = m_model_culler.size();
+		m_model_classifications.resize(nb_models);
+		m_model_versions.resize(nb_models);
+		m_model_buffers.resize(nb_models);
+
+		U64 models_version = nb_models;
+		for (std::size_t i = 0u; i < nb_models; ++i) {
+			const auto& model = m_model_culler.GetModel(i);
+			const auto& transform = model.GetOwner()->GetTransform();
+
+			const auto classification  = ModelClassification::Get(model);
+			m_model_classifications[i] = classification;
+			m_model_versions[i]        = HashCombine(
+				HashCombine(transform.GetVersion(), classification.m_state_key),
+				HashCombine(classification.m_buckets,
+							classification.m_occludes_light));
+			models_version = HashCombine(
+				HashCombine(models_version, reinterpret_cast< std::uintptr_t >(&model)),
+				m_model_versions[i]);
+
+			// Only models whose buffer is out of date recompute their buffer
+			// data.
+			m_model_buffers[i] = model.GetBufferData();
+		}
+
+		m_models_version = models_version;
+	}
+
+	void RenderFrame::ExtractLights(const World& world) {
+		// Accumulate all ambient light spectra.
+		XMVECTOR La = {};
+		world.ForEach< AmbientLight >([&La](const AmbientLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			La += XMLoad(light.GetRadianceSpectrum());
+		});
+		m_ambient_light = RGB(XMStore< F32x3 >(La));
+
+		// Extract the directional lights.
+		m_directional_lights.clear();
+		world.ForEach< DirectionalLight >([this](const DirectionalLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+
+			auto& snapshot = m_directional_lights.emplace_back();
+			snapshot.m_light_to_world      = transform.GetObjectToWorldMatrix();
+			snapshot.m_world_to_light      = transform.GetWorldToObjectMatrix();
+			snapshot.m_light_to_projection = light.GetLightToProjectionMatrix();
+			snapshot.m_aabb                = light.GetAABB();
+			snapshot.m_neg_d_world         = Direction3(XMStore< F32x3 >(
+				                             -transform.GetWorldAxisZ()));
+			snapshot.m_E_ortho             = light.GetIrradianceSpectrum();
+			snapshot.m_shadows             = light.UseShadows();
+		});
+
+		// Extract the omni lights.
+		m_omni_lights.clear();
+		world.ForEach< OmniLight >([this](const OmniLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+
+			auto& snapshot = m_omni_lights.emplace_back();
+			snapshot.m_light_to_world      = transform.GetObjectToWorldMatrix();
+			snapshot.m_world_to_light      = transform.GetWorldToObjectMatrix();
+			snapshot.m_light_to_projection = light.GetLightToProjectionMatrix();
+			snapshot.m_aabb                = light.GetAABB();
+			snapshot.m_sphere              = light.GetBoundingSphere();
+			snapshot.m_p_world             = Point3(XMStore< F32x3 >(
+				                             transform.GetWorldOrigin()));
+			snapshot.m_range               = light.GetWorldRange();
+			snapshot.m_I                   = light.GetIntensitySpectrum();
+			snapshot.m_shadows             = light.UseShadows();
+		});
+
+		// Extract the spotlights.
+		m_spot_lights.clear();
+		world.ForEach< SpotLight >([this](const SpotLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+
+			auto& snapshot = m_spot_lights.emplace_back();
+			snapshot.m_light_to_world      = transform.GetObjectToWorldMatrix();
+			snapshot.m_world_to_light      = transform.GetWorldToObjectMatrix();
+			snapshot.m_light_to_projection = light.GetLightToProjectionMatrix();
+			snapshot.m_aabb                = light.GetAABB();
+			snapshot.m_p_world             = Point3(XMStore< F32x3 >(
+				                             transform.GetWorldOrigin()));
+			snapshot.m_neg_d_world         = Direction3(XMStore< F32x3 >(
+				                             -transform.GetWorldAxisZ()));
+			snapshot.m_range               = light.GetWorldRange();
+			snapshot.m_I                   = light.GetIntensitySpectrum();
+			snapshot.m_cos_umbra           = light.GetEndAngularCutoff();
+			snapshot.m_cos_inv_range       = 1.0f / light.GetRangeAngularCutoff();
+			snapshot.m_guid                = light.GetGuid();
+			snapshot.m_shadows             = light.UseShadows();
+		});
+	}
+
+	void RenderFrame::ExtractViews(const World& world, AntiAliasing aa) {
+		// The render views are reused to preserve the capacity of their
+		// visible sets.
+		std::size_t nb_views = 0u;
+		world.ForEach< Camera >([this, aa, &nb_views](const Camera& camera) {
+			if (State::Active != camera.GetState()) {
+				return;
+			}
+
+			if (nb_views == m_views.size()) {
+				m_views.emplace_back();
+			}
+			auto& view = m_views[nb_views++];
+
+			const auto& transform       = camera.GetOwner()->GetTransform();
+			view.m_world_to_camera      = transform.GetWorldToObjectMatrix();
+			view.m_camera_to_projection = camera.GetCameraToProjectionMatrix();
+			view.m_world_to_projection  = view.m_world_to_camera
+				                        * view.m_camera_to_projection;
+			view.m_buffer               = camera.GetBufferData(aa);
+			view.m_viewport             = camera.GetViewport();
+			view.m_clipping_planes      = camera.GetClippingPlanes();
+			view.m_lens                 = camera.GetLens();
+			view.m_settings             = camera.GetSettings();
+			view.m_camera               = &camera;
+		});
+
+		m_views.resize(nb_views);
+	}
+
+	void RenderFrame::Prepare() {
+		m_model_culler.Build();
+
+		// Cull and classify the models once for all passes of each camera.
+		for (auto& view : m_views) {
+			m_model_culler.Cull(view.m_world_to_projection, view.m_visibility);
+			view.m_visible_set.Classify(m_model_culler,
+										m_model_classifications,
+										view.m_visibility,
+										view.m_world_to_camera);
+		}
+	}
+}
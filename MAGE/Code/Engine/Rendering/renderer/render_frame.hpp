@@ -0,0 +1,630 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\visible_set.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Light Snapshots
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of directional light snapshots.
+
+	 A directional light snapshot contains the data of an active directional
+	 light extracted from a world.
+	 */
+	struct alignas(16) DirectionalLightSnapshot {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The light-to-world transformation matrix of this directional light
+		 snapshot.
+		 */
+		XMMATRIX m_light_to_world;
+
+		/**
+		 The world-to-light transformation matrix of this directional light
+		 snapshot.
+		 */
+		XMMATRIX m_world_to_light;
+
+		/**
+		 The light-to-projection transformation matrix of this directional
+		 light snapshot.
+		 */
+		XMMATRIX m_light_to_projection;
+
+		/**
+		 The light-space AABB of this directional light snapshot.
+		 */
+		AABB m_aabb;
+
+		/**
+		 The (normalized) negated world-space direction of this directional
+		 light snapshot.
+		 */
+		Direction3 m_neg_d_world;
+
+		/**
+		 The irradiance spectrum of this directional light snapshot.
+		 */
+		RGB m_E_ortho;
+
+		/**
+		 A flag indicating whether this directional light snapshot casts
+		 shadows.
+		 */
+		bool m_shadows;
+	};
+
+	/**
+	 A struct of omni light snapshots.
+
+	 An omni light snapshot contains the data of an active omni light
+	 extracted from a world.
+	 */
+	struct alignas(16) OmniLightSnapshot {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The light-to-world transformation matrix of this omni light
+		 snapshot.
+		 */
+		XMMATRIX m_light_to_world;
+
+		/**
+		 The world-to-light transformation matrix of this omni light
+		 snapshot.
+		 */
+		XMMATRIX m_world_to_light;
+
+		/**
+		 The light-to-projection transformation matrix of this omni light
+		 snapshot.
+		 */
+		XMMATRIX m_light_to_projection;
+
+		/**
+		 The light-space AABB of this omni light snapshot.
+		 */
+		AABB m_aabb;
+
+		/**
+		 The light-space bounding sphere of this omni light snapshot.
+		 */
+		BoundingSphere m_sphere;
+
+		/**
+		 The world-space position of this omni light snapshot.
+		 */
+		Point3 m_p_world;
+
+		/**
+		 The world-space range of this omni light snapshot.
+		 */
+		F32 m_range;
+
+		/**
+		 The intensity spectrum of this omni light snapshot.
+		 */
+		RGB m_I;
+
+		/**
+		 A flag indicating whether this omni light snapshot casts shadows.
+		 */
+		bool m_shadows;
+	};
+
+	/**
+	 A struct of spotlight snapshots.
+
+	 A spotlight snapshot contains the data of an active spotlight extracted
+	 from a world.
+	 */
+	struct alignas(16) SpotLightSnapshot {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The light-to-world transformation matrix of this spotlight snapshot.
+		 */
+		XMMATRIX m_light_to_world;
+
+		/**
+		 The world-to-light transformation matrix of this spotlight snapshot.
+		 */
+		XMMATRIX m_world_to_light;
+
+		/**
+		 The light-to-projection transformation matrix of this spotlight
+		 snapshot.
+		 */
+		XMMATRIX m_light_to_projection;
+
+		/**
+		 The light-space AABB of this spotlight snapshot.
+		 */
+		AABB m_aabb;
+
+		/**
+		 The world-space position of this spotlight snapshot.
+		 */
+		Point3 m_p_world;
+
+		/**
+		 The (normalized) negated world-space direction of this spotlight
+		 snapshot.
+		 */
+		Direction3 m_neg_d_world;
+
+		/**
+		 The world-space range of this spotlight snapshot.
+		 */
+		F32 m_range;
+
+		/**
+		 The intensity spectrum of this spotlight snapshot.
+		 */
+		RGB m_I;
+
+		/**
+		 The cosine of the umbra angle of this spotlight snapshot.
+		 */
+		F32 m_cos_umbra;
+
+		/**
+		 The inverse of the range of the cosines of this spotlight snapshot.
+		 */
+		F32 m_cos_inv_range;
+
+		/**
+		 The guid of the spotlight of this spotlight snapshot.
+		 */
+		U64 m_guid;
+
+		/**
+		 A flag indicating whether this spotlight snapshot casts shadows.
+		 */
+		bool m_shadows;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RenderView
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of render views.
+
+	 A render view contains the data of an active camera extracted from a
+	 world, and the models which are visible for that camera. The camera
+	 itself is only used to access its GPU buffer.
+	 */
+	struct alignas(16) RenderView {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The world-to-camera transformation matrix of this render view.
+		 */
+		XMMATRIX m_world_to_camera;
+
+		/**
+		 The camera-to-projection transformation matrix of this render view.
+		 */
+		XMMATRIX m_camera_to_projection;
+
+		/**
+		 The world-to-projection transformation matrix of this render view.
+		 */
+		XMMATRIX m_world_to_projection;
+
+		/**
+		 The camera buffer data of this render view.
+		 */
+		CameraBuffer m_buffer;
+
+		/**
+		 The viewport of this render view.
+		 */
+		Viewport m_viewport;
+
+		/**
+		 The clipping planes of this render view expressed in camera space.
+		 */
+		F32x2 m_clipping_planes;
+
+		/**
+		 The lens of this render view.
+		 */
+		CameraLens m_lens;
+
+		/**
+		 The settings of this render view.
+		 */
+		CameraSettings m_settings;
+
+		/**
+		 A pointer to the camera of this render view. The camera is only
+		 accessed to update and bind its buffer while submitting this render
+		 view.
+		 */
+		const Camera* m_camera = nullptr;
+
+		/**
+		 The visibility mask of the models for this render view.
+		 */
+		VisibilityMask m_visibility;
+
+		/**
+		 The visible set of this render view.
+		 */
+		VisibleSet m_visible_set;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RenderFrame
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of render frames.
+
+	 A render frame is a snapshot of the render data of a world. It is
+	 extracted from a world on the thread owning that world (i.e. the world
+	 matrices, AABBs, material parameters, light parameters and camera data
+	 are copied into tightly packed vectors). The extracted render frame is
+	 prepared (i.e. culled and sorted) without accessing the world, and can
+	 thus be prepared concurrently with the simulation of the next frame.
+	 Neither extraction nor preparation access the device. The passes
+	 submitting a render frame only access the models of the world to bind
+	 their meshes and textures.
+	 */
+	class RenderFrame {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a render frame.
+		 */
+		RenderFrame();
+
+		/**
+		 Constructs a render frame from the given render frame.
+
+		 @param[in]		frame
+						A reference to the render frame to copy.
+		 */
+		RenderFrame(const RenderFrame& frame) = delete;
+
+		/**
+		 Constructs a render frame by moving the given render frame.
+
+		 @param[in]		frame
+						A reference to the render frame to move.
+		 */
+		RenderFrame(RenderFrame&& frame) noexcept;
+
+		/**
+		 Destructs this render frame.
+		 */
+		~RenderFrame();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render frame to this render frame.
+
+		 @param[in]		frame
+						A reference to the render frame to copy.
+		 @return		A reference to the copy of the given render frame
+						(i.e. this render frame).
+		 */
+		RenderFrame& operator=(const RenderFrame& frame) = delete;
+
+		/**
+		 Moves the given render frame to this render frame.
+
+		 @param[in]		frame
+						A reference to the render frame to move.
+		 @return		A reference to the moved render frame (i.e. this
+						render frame).
+		 */
+		RenderFrame& operator=(RenderFrame&& frame) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the version of the world from which this render frame is
+		 extracted.
+
+		 The components referenced by this render frame are only valid as
+		 long as the version of the world equals this version.
+
+		 @return		The version of the world from which this render
+						frame is extracted.
+		 */
+		[[nodiscard]]
+		U64 GetWorldVersion() const noexcept {
+			return m_world_version;
+		}
+
+		/**
+		 Returns the model culler of this render frame.
+
+		 @return		A reference to the model culler of this render frame.
+		 */
+		[[nodiscard]]
+		const ModelCuller& GetModelCuller() const noexcept {
+			return m_model_culler;
+		}
+
+		/**
+		 Returns the model classifications of this render frame.
+
+		 @return		A reference to a vector containing the model
+						classification of each model of the model culler of
+						this render frame.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelClassification >&
+			GetModelClassifications() const noexcept {
+
+			return m_model_classifications;
+		}
+
+		/**
+		 Returns the model versions of this render frame.
+
+		 @return		A reference to a vector containing the version of
+						each model of the model culler of this render frame.
+		 */
+		[[nodiscard]]
+		const std::vector< U64 >& GetModelVersions() const noexcept {
+			return m_model_versions;
+		}
+
+		/**
+		 Returns the version of the models of this render frame. The version
+		 changes whenever the set of models, or the transform or render state
+		 of any model changes.
+
+		 @return		The version of the models of this render frame.
+		 */
+		[[nodiscard]]
+		U64 GetModelsVersion() const noexcept {
+			return m_models_version;
+		}
+
+		/**
+		 Returns the model buffer data of this render frame.
+
+		 @return		A reference to a vector containing the buffer data
+						of each model of the model culler of this render
+						frame.
+		 */
+		[[nodiscard]]
+		const AlignedVector< ModelBuffer >& GetModelBuffers() const noexcept {
+			return m_model_buffers;
+		}
+
+		/**
+		 Returns the accumulated ambient light spectrum of this render frame.
+
+		 @return		The accumulated radiance spectrum of the ambient
+						lights of this render frame.
+		 */
+		[[nodiscard]]
+		const RGB GetAmbientLight() const noexcept {
+			return m_ambient_light;
+		}
+
+		/**
+		 Returns the directional lights of this render frame.
+
+		 @return		A reference to a vector containing the snapshot of
+						each active directional light of this render frame.
+		 */
+		[[nodiscard]]
+		const AlignedVector< DirectionalLightSnapshot >&
+			GetDirectionalLights() const noexcept {
+
+			return m_directional_lights;
+		}
+
+		/**
+		 Returns the omni lights of this render frame.
+
+		 @return		A reference to a vector containing the snapshot of
+						each active omni light of this render frame.
+		 */
+		[[nodiscard]]
+		const AlignedVector< OmniLightSnapshot >& GetOmniLights() const noexcept {
+			return m_omni_lights;
+		}
+
+		/**
+		 Returns the spotlights of this render frame.
+
+		 @return		A reference to a vector containing the snapshot of
+						each active spotlight of this render frame.
+		 */
+		[[nodiscard]]
+		const AlignedVector< SpotLightSnapshot >& GetSpotLights() const noexcept {
+			return m_spot_lights;
+		}
+
+		/**
+		 Returns the render views of this render frame.
+
+		 @return		A reference to a vector containing the render view
+						of each active camera of this render frame.
+		 */
+		[[nodiscard]]
+		const AlignedVector< RenderView >& GetViews() const noexcept {
+			return m_views;
+		}
+
+		/**
+		 Extracts this render frame from the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 @param[in]		aa
+						The anti-aliasing mode.
+		 */
+		void Extract(const World& world, AntiAliasing aa);
+
+		/**
+		 Prepares this render frame for submission.
+
+		 @pre			This render frame is extracted.
+		 */
+		void Prepare();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Extracts the models of this render frame from the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void ExtractModels(const World& world);
+
+		/**
+		 Extracts the lights of this render frame from the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void ExtractLights(const World& world);
+
+		/**
+		 Extracts the render views of this render frame from the given
+		 world.
+
+		 @param[in]		world
+						A reference to the world.
+		 @param[in]		aa
+						The anti-aliasing mode.
+		 */
+		void ExtractViews(const World& world, AntiAliasing aa);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The model culler of this render frame.
+		 */
+		ModelCuller m_model_culler;
+
+		/**
+		 A vector containing the model classification of each model of the
+		 model culler of this render frame.
+		 */
+		std::vector< ModelClassification > m_model_classifications;
+
+		/**
+		 A vector containing the version of each model of the model culler
+		 of this render frame. The version of a model changes whenever its
+		 transform or its render state changes.
+		 */
+		std::vector< U64 > m_model_versions;
+
+		/**
+		 The version of the models of this render frame.
+		 */
+		U64 m_models_version;
+
+		/**
+		 A vector containing the buffer data of each model of the model
+		 culler of this render frame.
+		 */
+		AlignedVector< ModelBuffer > m_model_buffers;
+
+		/**
+		 The accumulated radiance spectrum of the ambient lights of this
+		 render frame.
+		 */
+		RGB m_ambient_light;
+
+		/**
+		 A vector containing the snapshot of each active directional light
+		 of this render frame.
+		 */
+		AlignedVector< DirectionalLightSnapshot > m_directional_lights;
+
+		/**
+		 A vector containing the snapshot of each active omni light of this
+		 render frame.
+		 */
+		AlignedVector< OmniLightSnapshot > m_omni_lights;
+
+		/**
+		 A vector containing the snapshot of each active spotlight of this
+		 render frame.
+		 */
+		AlignedVector< SpotLightSnapshot > m_spot_lights;
+
+		/**
+		 A vector containing the render view of each active camera of this
+		 render frame.
+		 */
+		AlignedVector< RenderView > m_views;
+
+		/**
+		 The version of the world from which this render frame is extracted.
+		 */
+		U64 m_world_version;
+	};
+
+	#pragma endregion
+}
@@ -4,6 +4,7 @@
 #pragma region
 
 #include "renderer\renderer.hpp"
+#include "renderer\render_frame.hpp"
 #include "renderer\output_manager.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
@@ -17,7 +18,9 @@
 #include "renderer\pass\sprite_pass.hpp"
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\pass\voxel_grid_pass.hpp"
+#include "renderer\buffer\constant_buffer_ring.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
+#include "parallel\frame_pipeline.hpp"
 #include "ImGui\imgui_impl_dx11.h"
 
 // Include HLSL bindings.
@@ -59,12 +62,15 @@ namespace mage::rendering {
 						A reference to the swap chain.
 		 @param[in,out]	resource_manager
 						A pointer to the resource manager.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Impl(ID3D11Device& device,
 					  ID3D11DeviceContext& device_context,
 					  DisplayConfiguration& display_configuration,
 					  SwapChain& swap_chain,
-					  ResourceManager& resource_manager);
+					  ResourceManager& resource_manager,
+					  JobSystem& job_system);
 
 		/**
 		 Constructs a renderer from the given renderer.
@@ -125,6 +131,14 @@ namespace mage::rendering {
 		/**
 		 Renders the given world.
 
+		 The render frame of the world is extracted, and submitted after
+		 the render frame of the previous call is prepared. The preparation
+		 of the extracted render frame overlaps with the submission of the
+		 prepared render frame and the next update of the world. Rendering
+		 thus lags one frame behind the world, unless the world is
+		 restructured in which case the extracted render frame is prepared
+		 and submitted immediately.
+
 		 @param[in]		world
 						A reference to the world.
 		 @param[in]		time
@@ -142,36 +156,33 @@ namespace mage::rendering {
 
 		void InitializePasses();
 
-		void UpdateBuffers(const World& world, const GameTime& time);
+		void Submit(const World& world,
+					const RenderFrame& frame,
+					const GameTime& time);
+
+		void UpdateBuffers(const RenderFrame& frame, const GameTime& time);
 
 		void UpdateWorldBuffer(const GameTime& time);
 
-		void Render(const World& world, const Camera& camera);
+		void XM_CALLCONV CullVoxelGrid(const ModelCuller& culler,
+									   FXMMATRIX world_to_voxel);
+
+		void Render(const RenderFrame& frame, const RenderView& view);
 
-		void XM_CALLCONV RenderForward(const World& world,
-									   const Camera& camera,
-									   FXMMATRIX world_to_projection);
+		void RenderForward(const RenderFrame& frame, const RenderView& view);
 
-		void XM_CALLCONV RenderDeferred(const World& world,
-										const Camera& camera,
-										FXMMATRIX world_to_projection);
+		void RenderDeferred(const RenderFrame& frame, const RenderView& view);
 
-		void XM_CALLCONV RenderSolid(const World& world,
-									 const Camera& camera,
-									 FXMMATRIX world_to_projection);
+		void RenderSolid(const RenderFrame& frame, const RenderView& view);
 
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  const Camera& camera,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color);
+		void RenderFalseColor(const RenderView& view,
+							  FalseColor false_color);
 
-		void XM_CALLCONV RenderVoxelGrid(const World& world,
-										 const Camera& camera,
-										 FXMMATRIX world_to_projection);
+		void RenderVoxelGrid(const RenderFrame& frame, const RenderView& view);
 
-		void RenderAA(const Camera& camera);
+		void RenderAA(const RenderView& view);
 
-		void RenderPostProcessing(const Camera& camera);
+		void RenderPostProcessing(const RenderView& view);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -197,6 +208,11 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ResourceManager > m_resource_manager;
 
+		/**
+		 A reference to the job system of this renderer.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the output manager of this rendering manager.
 		 */
@@ -216,6 +232,26 @@ namespace mage::rendering {
 		 */
 		ConstantBuffer< WorldBuffer > m_world_buffer;
 
+		/**
+		 The constant buffer ring containing the model buffers of this
+		 renderer.
+		 */
+		ConstantBufferRing< ModelBuffer > m_model_buffers;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Culling
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the frame pipeline of this renderer.
+		 */
+		UniquePtr< FramePipeline< RenderFrame > > m_frames;
+
+		/**
+		 The visibility mask of the models for the voxel grid.
+		 */
+		VisibilityMask m_voxel_grid_visibility;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Passes
 		//---------------------------------------------------------------------
@@ -285,16 +321,21 @@ namespace mage::rendering {
 						 ID3D11DeviceContext& device_context,
 						 DisplayConfiguration& display_configuration,
 						 SwapChain& swap_chain,
-						 ResourceManager& resource_manager)
+						 ResourceManager& resource_manager,
+						 JobSystem& job_system)
 		: m_display_configuration(display_configuration),
 		m_device(device),
 		m_device_context(device_context),
 		m_resource_manager(resource_manager),
+		m_job_system(job_system),
 		m_output_manager(MakeUnique< OutputManager >(device,
 													 display_configuration,
 													 swap_chain)),
 		m_state_manager(MakeUnique< StateManager >(device)),
 		m_world_buffer(device),
+		m_model_buffers(device, device_context),
+		m_frames(MakeUnique< FramePipeline< RenderFrame > >(job_system)),
+		m_voxel_grid_visibility(),
 		m_aa_pass(),
 		m_back_buffer_pass(),
 		m_bounding_volume_pass(),
@@ -348,7 +389,8 @@ namespace mage::rendering {
 		m_lbuffer_pass = MakeUnique< LBufferPass >(m_device,
 												   m_device_context,
 												   *m_state_manager.get(),
-												   m_resource_manager);
+												   m_resource_manager,
+												   m_job_system);
 
 		m_postprocess_pass = MakeUnique< PostProcessPass >(m_device_context,
 														   *m_state_manager.get(),
@@ -378,8 +420,37 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::Render(const World& world, const GameTime& time) {
+		// Extract the render frame of the world, while the render frame of
+		// the previous call is prepared.
+		auto& extracted_frame = m_frames->GetExtractionFrame();
+		extracted_frame.Extract(world, m_display_configuration.get().GetAA());
+
+		const auto prepare = [](RenderFrame& frame) {
+			frame.Prepare();
+		};
+
+		auto frame = m_frames->Wait();
+		if (nullptr == frame || world.GetVersion() != frame->GetWorldVersion()) {
+			// The prepared render frame may refer to components which no
+			// longer exist: the extracted render frame is prepared and
+			// submitted immediately instead.
+			m_frames->Prepare(prepare);
+			frame = m_frames->Wait();
+		}
+		else {
+			// The extracted render frame is prepared during the submission
+			// of the prepared render frame and the next update of the world.
+			m_frames->Prepare(prepare);
+		}
+
+		Submit(world, *frame, time);
+	}
+
+	void Renderer::Impl::Submit(const World& world,
+								const RenderFrame& frame,
+								const GameTime& time) {
 		// Update the buffers.
-		UpdateBuffers(world, time);
+		UpdateBuffers(frame, time);
 
 		// Bind the world buffer.
 		m_world_buffer.Bind< Pipeline >(m_device_context, SLOT_CBUFFER_WORLD);
@@ -387,14 +458,9 @@ namespace mage::rendering {
 		m_output_manager->BindBegin(m_device_context);
 
 		// Render the world for each camera.
-		world.ForEach< Camera >([this, &world](const Camera& camera) {
-			if (State::Active != camera.GetState()) {
-				return;
-			}
-
-			// Render the world.
-			Render(world, camera);
-		});
+		for (const auto& view : frame.GetViews()) {
+			Render(frame, view);
+		}
 
 		m_output_manager->BindGUI(m_device_context);
 
@@ -411,6 +477,8 @@ namespace mage::rendering {
 		// GUI
 		ImGui::Render();
 		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		// ImGui binds its state directly on the device context.
+		Pipeline::InvalidateBindings();
 
 		m_output_manager->BindEnd(m_device_context);
 
@@ -420,25 +488,25 @@ namespace mage::rendering {
 		m_back_buffer_pass->Render();
 	}
 
-	void Renderer::Impl::UpdateBuffers(const World& world,
+	void Renderer::Impl::UpdateBuffers(const RenderFrame& frame,
 									   const GameTime& time) {
 		// Update the world buffer.
 		UpdateWorldBuffer(time);
 
 		// Update the buffer of each camera.
-		world.ForEach< Camera >([this](const Camera& camera) {
-			if (State::Active == camera.GetState()) {
-				camera.UpdateBuffer(m_device_context,
-									m_display_configuration.get().GetAA());
-			}
-		});
-
-		// Update the buffer of each model.
-		world.ForEach< Model >([this](const Model& model) {
-			if (State::Active == model.GetState()) {
-				model.UpdateBuffer(m_device_context);
-			}
-		});
+		for (const auto& view : frame.GetViews()) {
+			view.m_camera->UpdateBuffer(m_device_context, view.m_buffer);
+		}
+
+		// Write the extracted buffer of each model to the ring, or to the
+		// constant buffer of each model if the ring is not supported.
+		const auto& culler  = frame.GetModelCuller();
+		const auto& buffers = frame.GetModelBuffers();
+		m_model_buffers.BeginFrame(culler.size());
+		for (std::size_t i = 0u; i < culler.size(); ++i) {
+			culler.GetModel(i).UpdateBuffer(m_model_buffers, buffers[i]);
+		}
+		m_model_buffers.EndFrame();
 	}
 
 	void Renderer::Impl::UpdateWorldBuffer(const GameTime& time) {
@@ -490,19 +558,20 @@ namespace mage::rendering {
 		m_world_buffer.UpdateData(m_device_context, buffer);
 	}
 
-	void Renderer::Impl::Render(const World& world, const Camera& camera) {
-		// Bind the camera to the pipeline.
-		camera.BindBuffer< Pipeline >(m_device_context,
-									  SLOT_CBUFFER_PRIMARY_CAMERA);
+	void XM_CALLCONV Renderer::Impl::CullVoxelGrid(const ModelCuller& culler,
+												   FXMMATRIX world_to_voxel) {
 
-		// Obtain the world-to-projection transformation matrix of the
-		// camera for view frustum culling.
-		const auto& transform            = camera.GetOwner()->GetTransform();
-		const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
-		const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
-		const auto  world_to_projection  = world_to_camera * camera_to_projection;
+		culler.Cull(world_to_voxel, m_voxel_grid_visibility);
+	}
 
-		const auto  render_mode          = camera.GetSettings().GetRenderMode();
+	void Renderer::Impl::Render(const RenderFrame& frame,
+								const RenderView& view) {
+
+		// Bind the camera to the pipeline.
+		view.m_camera->BindBuffer< Pipeline >(m_device_context,
+											  SLOT_CBUFFER_PRIMARY_CAMERA);
+
+		const auto render_mode = view.m_settings.GetRenderMode();
 
 		m_output_manager->BindBeginViewport(m_device_context);
 
@@ -512,113 +581,96 @@ namespace mage::rendering {
 		switch (render_mode) {
 
 		case RenderMode::Forward: {
-			RenderForward(world, camera, world_to_projection);
+			RenderForward(frame, view);
 			break;
 		}
 
 		case RenderMode::Deferred: {
-			RenderDeferred(world, camera, world_to_projection);
+			RenderDeferred(frame, view);
 			break;
 		}
 
 		case RenderMode::Solid: {
-			RenderSolid(world, camera, world_to_projection);
+			RenderSolid(frame, view);
 			break;
 		}
 
 		case RenderMode::VoxelGrid: {
-			RenderVoxelGrid(world, camera, world_to_projection);
+			RenderVoxelGrid(frame, view);
 			break;
 		}
 
 		case RenderMode::FalseColor_BaseColor: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColor);
+			RenderFalseColor(view, FalseColor::BaseColor);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorCoefficient);
+			RenderFalseColor(view, FalseColor::BaseColorCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorTexture);
+			RenderFalseColor(view, FalseColor::BaseColorTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Material: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Material);
+			RenderFalseColor(view, FalseColor::Material);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialCoefficient);
+			RenderFalseColor(view, FalseColor::MaterialCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialTexture);
+			RenderFalseColor(view, FalseColor::MaterialTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Roughness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Roughness);
+			RenderFalseColor(view, FalseColor::Roughness);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessCoefficient);
+			RenderFalseColor(view, FalseColor::RoughnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessTexture);
+			RenderFalseColor(view, FalseColor::RoughnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Metalness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Metalness);
+			RenderFalseColor(view, FalseColor::Metalness);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessCoefficient);
+			RenderFalseColor(view, FalseColor::MetalnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessTexture);
+			RenderFalseColor(view, FalseColor::MetalnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_ShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::ShadingNormal);
+			RenderFalseColor(view, FalseColor::ShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_TSNMShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::TSNMShadingNormal);
+			RenderFalseColor(view, FalseColor::TSNMShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_Depth: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Depth);
+			RenderFalseColor(view, FalseColor::Depth);
 			break;
 		}
 		case RenderMode::FalseColor_Distance: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Distance);
+			RenderFalseColor(view, FalseColor::Distance);
 			break;
 		}
 		case RenderMode::FalseColor_UV: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::UV);
+			RenderFalseColor(view, FalseColor::UV);
 			break;
 		}
 
 		default: {
-			const Viewport viewport(camera.GetViewport(),
+			const Viewport viewport(view.m_viewport,
 									m_display_configuration.get().GetAA());
 			viewport.Bind(m_device_context);
 			m_output_manager->BindBeginForward(m_device_context);
@@ -631,12 +683,12 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// RenderLayer
 		//---------------------------------------------------------------------
-		const auto& settings = camera.GetSettings();
+		const auto& settings = view.m_settings;
 		if (settings.ContainsRenderLayer(RenderLayer::Wireframe)) {
-			m_forward_pass->RenderWireframe(world, world_to_projection);
+			m_forward_pass->RenderWireframe(view.m_visible_set);
 		}
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
-			m_bounding_volume_pass->Render(world, world_to_projection);
+			m_bounding_volume_pass->Render(frame, view);
 		}
 
 		m_output_manager->BindEndForward(m_device_context);
@@ -644,19 +696,20 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Anti-aliasing
 		//---------------------------------------------------------------------
-		RenderAA(camera);
+		RenderAA(view);
 
 		//---------------------------------------------------------------------
 		// Post-processing
 		//---------------------------------------------------------------------
-		RenderPostProcessing(camera);
+		RenderPostProcessing(view);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderForward(const World& world,
-												   const Camera& camera,
-												   FXMMATRIX world_to_projection) {
+	void Renderer::Impl::RenderForward(const RenderFrame& frame,
+									   const RenderView& view) {
+
+		const auto& culler = frame.GetModelCuller();
 
-		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
+		const auto vct = view.m_settings.GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer + Voxelization
@@ -666,19 +719,20 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(frame, view);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
 
-			m_voxelization_pass->Render(world, world_to_voxel,
+			CullVoxelGrid(culler, world_to_voxel);
+			m_voxelization_pass->Render(culler, m_voxel_grid_visibility,
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(frame, view);
 		}
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(view.m_viewport,
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -687,35 +741,35 @@ namespace mage::rendering {
 		// Depth
 		//---------------------------------------------------------------------
 		if (vct) {
-			const auto& transform            = camera.GetOwner()->GetTransform();
-			const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
-			const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
-			m_depth_pass->Render(world, world_to_camera, camera_to_projection);
+			m_depth_pass->Render(view.m_visible_set,
+								 view.m_world_to_camera,
+								 view.m_camera_to_projection);
 		}
 
 		//---------------------------------------------------------------------
 		// Forward: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->Render(world, world_to_projection,
-							   camera.GetSettings().GetBRDF(), vct);
+		m_forward_pass->Render(view.m_visible_set,
+							   view.m_settings.GetBRDF(), vct);
 
 		//---------------------------------------------------------------------
 		// Sky
 		//---------------------------------------------------------------------
-		m_sky_pass->Render(camera.GetSettings().GetSky().GetSRV());
+		m_sky_pass->Render(view.m_settings.GetSky().GetSRV());
 
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
-										  camera.GetSettings().GetBRDF(), vct);
+		m_forward_pass->RenderTransparent(view.m_visible_set,
+										  view.m_settings.GetBRDF(), vct);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderDeferred(const World& world,
-													const Camera& camera,
-													FXMMATRIX world_to_projection) {
+	void Renderer::Impl::RenderDeferred(const RenderFrame& frame,
+										const RenderView& view) {
 
-		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
+		const auto& culler = frame.GetModelCuller();
+
+		const auto vct = view.m_settings.GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer + Voxelization
@@ -725,19 +779,20 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(frame, view);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
 
-			m_voxelization_pass->Render(world, world_to_voxel,
+			CullVoxelGrid(culler, world_to_voxel);
+			m_voxelization_pass->Render(culler, m_voxel_grid_visibility,
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(frame, view);
 		}
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(view.m_viewport,
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginGBuffer(m_device_context);
@@ -745,7 +800,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// GBuffer: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderGBuffer(world, world_to_projection);
+		m_forward_pass->RenderGBuffer(view.m_visible_set);
 
 		m_output_manager->BindEndGBuffer(m_device_context);
 		m_output_manager->BindBeginDeferred(m_device_context);
@@ -754,11 +809,11 @@ namespace mage::rendering {
 		// Deferred: opaque fragments
 		//---------------------------------------------------------------------
 		if (m_display_configuration.get().UsesMSAA()) {
-			m_deferred_pass->Render(camera.GetSettings().GetBRDF(), vct);
+			m_deferred_pass->Render(view.m_settings.GetBRDF(), vct);
 		}
 		else {
 			m_deferred_pass->Dispatch(viewport.GetSize(),
-									  camera.GetSettings().GetBRDF(), vct);
+									  view.m_settings.GetBRDF(), vct);
 		}
 
 		m_output_manager->BindEndDeferred(m_device_context);
@@ -767,30 +822,29 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: emissive fragments.
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderEmissive(world, world_to_projection);
+		m_forward_pass->RenderEmissive(view.m_visible_set);
 
 		//---------------------------------------------------------------------
 		// Perform a sky pass.
 		//---------------------------------------------------------------------
-		m_sky_pass->Render(camera.GetSettings().GetSky().GetSRV());
+		m_sky_pass->Render(view.m_settings.GetSky().GetSRV());
 
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
-										  camera.GetSettings().GetBRDF(), vct);
+		m_forward_pass->RenderTransparent(view.m_visible_set,
+										  view.m_settings.GetBRDF(), vct);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderSolid(const World& world,
-												 const Camera& camera,
-												 FXMMATRIX world_to_projection) {
+	void Renderer::Impl::RenderSolid(const RenderFrame& frame,
+									 const RenderView& view) {
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(frame, view);
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(view.m_viewport,
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -798,15 +852,13 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderSolid(world, world_to_projection);
+		m_forward_pass->RenderSolid(view.m_visible_set);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderFalseColor(const World& world,
-													  const Camera& camera,
-													  FXMMATRIX world_to_projection,
-													  FalseColor false_color) {
+	void Renderer::Impl::RenderFalseColor(const RenderView& view,
+										  FalseColor false_color) {
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(view.m_viewport,
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -814,17 +866,19 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderFalseColor(world, world_to_projection, false_color);
+		m_forward_pass->RenderFalseColor(view.m_visible_set,
+										 false_color);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderVoxelGrid(const World& world,
-													 const Camera& camera,
-													 FXMMATRIX world_to_projection) {
+	void Renderer::Impl::RenderVoxelGrid(const RenderFrame& frame,
+										 const RenderView& view) {
+
+		const auto& culler = frame.GetModelCuller();
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(frame, view);
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -833,11 +887,12 @@ namespace mage::rendering {
 			= VoxelizationSettings::GetWorldToVoxelMatrix();
 		const auto voxel_grid_resolution
 			= VoxelizationSettings::GetVoxelGridResolution();
-		m_voxelization_pass->Render(world, world_to_voxel,
+		CullVoxelGrid(culler, world_to_voxel);
+		m_voxelization_pass->Render(culler, m_voxel_grid_visibility,
 									voxel_grid_resolution);
 
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(view.m_viewport,
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -848,8 +903,8 @@ namespace mage::rendering {
 		m_voxel_grid_pass->Render(voxel_grid_resolution);
 	}
 
-	void Renderer::Impl::RenderPostProcessing(const Camera& camera) {
-		const auto& viewport = camera.GetViewport();
+	void Renderer::Impl::RenderPostProcessing(const RenderView& view) {
+		const auto& viewport = view.m_viewport;
 		viewport.Bind(m_device_context);
 
 		m_output_manager->BindBeginPostProcessing(m_device_context);
@@ -857,7 +912,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Depth-of-field
 		//---------------------------------------------------------------------
-		if (camera.GetLens().HasFiniteAperture()) {
+		if (view.m_lens.HasFiniteAperture()) {
 			m_output_manager->BindPingPong(m_device_context);
 
 			m_postprocess_pass->DispatchDOF(viewport.GetSize());
@@ -870,10 +925,10 @@ namespace mage::rendering {
 		// Low Dynamic Range
 		//---------------------------------------------------------------------
 		m_postprocess_pass->DispatchLDR(viewport.GetSize(),
-										camera.GetSettings().GetToneMapping());
+										view.m_settings.GetToneMapping());
 	}
 
-	void Renderer::Impl::RenderAA(const Camera& camera) {
+	void Renderer::Impl::RenderAA(const RenderView& view) {
 		const auto desc = m_display_configuration.get().GetAA();
 
 		switch (desc) {
@@ -884,7 +939,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// AA pre-processing
 			//-----------------------------------------------------------------
-			m_aa_pass->DispatchPreprocess(camera.GetViewport().GetSize(),
+			m_aa_pass->DispatchPreprocess(view.m_viewport.GetSize(),
 										  AntiAliasing::FXAA);
 
 			m_output_manager->BindEndResolve(m_device_context);
@@ -893,7 +948,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// FXAA
 			//-----------------------------------------------------------------
-			m_aa_pass->Dispatch(camera.GetViewport().GetSize(),
+			m_aa_pass->Dispatch(view.m_viewport.GetSize(),
 								AntiAliasing::FXAA);
 
 			break;
@@ -910,7 +965,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// MSAA/SSAA
 			//-----------------------------------------------------------------
-			m_aa_pass->Dispatch(camera.GetViewport().GetSize(), desc);
+			m_aa_pass->Dispatch(view.m_viewport.GetSize(), desc);
 
 			m_output_manager->BindEndResolve(m_device_context);
 			break;
@@ -930,12 +985,14 @@ namespace mage::rendering {
 					   ID3D11DeviceContext& device_context,
 					   DisplayConfiguration& display_configuration,
 					   SwapChain& swap_chain,
-					   ResourceManager& resource_manager)
+					   ResourceManager& resource_manager,
+					   JobSystem& job_system)
 		: m_impl(MakeUnique< Impl >(device,
 									device_context,
 									display_configuration,
 									swap_chain,
-									resource_manager)) {}
+									resource_manager,
+									job_system)) {}
 
 	Renderer::Renderer(Renderer&& renderer) noexcept = default;
 
@@ -0,0 +1,380 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow_atlas_packer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Returns the base-2 logarithm of the given power of two.
+
+		 @pre			@a x is a power of two.
+		 @param[in]		x
+						The power of two.
+		 @return		The base-2 logarithm of @a x.
+		 */
+		[[nodiscard]]
+		constexpr U32 Log2(U32 x) noexcept {
+			U32 result = 0u;
+			while (x >>= 1u) {
+				++result;
+			}
+			return result;
+		}
+
+		/**
+		 Returns the index of the first quadtree node of the given level.
+
+		 @param[in]		level
+						The level.
+		 @return		The index of the first quadtree node of @a level
+						(i.e. the number of nodes of all coarser levels).
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetLevelOffset(U32 level) noexcept {
+			return ((std::size_t(1u) << (2u * level)) - 1u) / 3u;
+		}
+
+		/**
+		 Compacts the even bits of the given Morton code.
+
+		 @param[in]		code
+						The Morton code.
+		 @return		The even bits of @a code.
+		 */
+		[[nodiscard]]
+		constexpr U32 CompactBits(U32 code) noexcept {
+			code &= 0x55555555u;
+			code = (code ^ (code >> 1u)) & 0x33333333u;
+			code = (code ^ (code >> 2u)) & 0x0F0F0F0Fu;
+			code = (code ^ (code >> 4u)) & 0x00FF00FFu;
+			code = (code ^ (code >> 8u)) & 0x0000FFFFu;
+			return code;
+		}
+	}
+
+	[[nodiscard]]
+	F32 XM_CALLCONV ShadowAtlasPacker
+		::GetImportance(const BoundingSphere& sphere,
+						FXMMATRIX world_to_camera,
+						CXMMATRIX camera_to_projection) noexcept {
+
+		const auto p_camera = XMVector3TransformCoord(sphere.Centroid(),
+													  world_to_camera);
+		const auto z = XMVectorGetZ(p_camera);
+		const auto r = sphere.Radius();
+
+		// The camera is located inside the bounding sphere.
+		if (z <= r) {
+			return 1.0f;
+		}
+
+		const auto w = z * XMVectorGetW(camera_to_projection.r[2])
+			             + XMVectorGetW(camera_to_projection.r[3]);
+		const auto scale = std::max(XMVectorGetX(camera_to_projection.r[0]),
+									XMVectorGetY(camera_to_projection.r[1]));
+
+		return std::min(1.0f, r * scale / w);
+	}
+
+	ShadowAtlasPacker::ShadowAtlasPacker(U32 resolution,
+										 U32 min_tile_resolution,
+										 U32 max_tile_resolution)
+		: m_resolution(resolution),
+		m_min_level(Log2(resolution / max_tile_resolution)),
+		m_max_level(Log2(resolution / min_tile_resolution)),
+		m_states(GetLevelOffset(m_max_level + 1u), NodeState::Free),
+		m_allocations(),
+		m_order(),
+		m_levels() {}
+
+	ShadowAtlasPacker::ShadowAtlasPacker(
+		const ShadowAtlasPacker& packer) = default;
+
+	ShadowAtlasPacker::ShadowAtlasPacker(
+		ShadowAtlasPacker&& packer) noexcept = default;
+
+	ShadowAtlasPacker::~ShadowAtlasPacker() = default;
+
+	ShadowAtlasPacker& ShadowAtlasPacker
+		::operator=(const ShadowAtlasPacker& packer) = default;
+
+	ShadowAtlasPacker& ShadowAtlasPacker
+		::operator=(ShadowAtlasPacker&& packer) noexcept = default;
+
+	void ShadowAtlasPacker::Pack(const std::vector< ShadowAtlasRequest >& requests,
+								 std::vector< ShadowAtlasTile >& tiles) {
+
+		tiles.assign(requests.size(), ShadowAtlasTile());
+
+		// Pack the most important requests first.
+		m_order.resize(requests.size());
+		std::iota(m_order.begin(), m_order.end(), std::size_t(0u));
+		std::stable_sort(m_order.begin(), m_order.end(),
+			[&requests](std::size_t lhs, std::size_t rhs) noexcept {
+				return requests[lhs].m_importance > requests[rhs].m_importance;
+			});
+
+		for (auto& [key, allocation] : m_allocations) {
+			allocation.m_requested = false;
+		}
+
+		// Retain the allocations whose tile is not too large. Tiles which are
+		// too small are only replaced if a larger tile is available.
+		for (const auto i : m_order) {
+			const auto& request = requests[i];
+			const auto it = m_allocations.find(request.m_key);
+			if (m_allocations.cend() == it) {
+				continue;
+			}
+
+			auto& allocation = it->second;
+			const auto level = GetLevel(request.m_importance);
+			if (allocation.m_level + 1u < level) {
+				Release(allocation.m_level, allocation.m_node);
+				m_allocations.erase(it);
+				continue;
+			}
+
+			allocation.m_requested = true;
+			allocation.m_upgrade   = level + 1u < allocation.m_level;
+			tiles[i] = GetTile(allocation.m_level, allocation.m_node);
+			tiles[i].m_reallocated = false;
+		}
+
+		// Release the allocations which are not requested anymore.
+		for (auto it = m_allocations.begin(); m_allocations.end() != it;) {
+			if (it->second.m_requested) {
+				++it;
+				continue;
+			}
+
+			Release(it->second.m_level, it->second.m_node);
+			it = m_allocations.erase(it);
+		}
+
+		// Allocate the missing tiles (downsized if needed).
+		for (const auto i : m_order) {
+			if (0u != tiles[i].m_resolution) {
+				continue;
+			}
+
+			const auto& request = requests[i];
+			auto allocated = false;
+			for (auto level = GetLevel(request.m_importance);
+				 level <= m_max_level && !allocated; ++level) {
+
+				U32 node = 0u;
+				if (Allocate(0u, 0u, level, node)) {
+					m_allocations.emplace(request.m_key,
+										  Allocation{ level, node, true, false });
+					tiles[i] = GetTile(level, node);
+					allocated = true;
+				}
+			}
+
+			if (!allocated) {
+				Repack(requests, tiles);
+				return;
+			}
+		}
+
+		// Enlarge the tiles which are too small if possible.
+		for (const auto i : m_order) {
+			const auto& request = requests[i];
+			auto& allocation = m_allocations[request.m_key];
+			if (!allocation.m_upgrade) {
+				continue;
+			}
+
+			const auto level = GetLevel(request.m_importance);
+			U32 node = 0u;
+			if (Allocate(0u, 0u, level, node)) {
+				Release(allocation.m_level, allocation.m_node);
+				allocation.m_level = level;
+				allocation.m_node  = node;
+				tiles[i] = GetTile(level, node);
+			}
+
+			allocation.m_upgrade = false;
+		}
+	}
+
+	void ShadowAtlasPacker::Repack(const std::vector< ShadowAtlasRequest >& requests,
+								   std::vector< ShadowAtlasTile >& tiles) {
+		Clear();
+
+		// The area of the shadow atlas expressed in tiles of the minimum
+		// resolution.
+		const auto capacity = std::size_t(1u) << (2u * m_max_level);
+		const auto GetArea = [this](U32 level) noexcept {
+			return std::size_t(1u) << (2u * (m_max_level - level));
+		};
+
+		m_levels.resize(requests.size());
+		std::size_t area = 0u;
+		for (std::size_t i = 0u; i < requests.size(); ++i) {
+			m_levels[i] = GetLevel(requests[i].m_importance);
+			area += GetArea(m_levels[i]);
+		}
+
+		// Downsize the largest (and least important) tiles first.
+		while (capacity < area) {
+			auto largest = m_order.crend();
+			for (auto it = m_order.crbegin(); m_order.crend() != it; ++it) {
+				if (m_levels[*it] < m_max_level
+					&& (m_order.crend() == largest
+						|| m_levels[*it] < m_levels[*largest])) {
+					largest = it;
+				}
+			}
+
+			if (m_order.crend() == largest) {
+				// All tiles have the minimum resolution: the least important
+				// tiles will not be allocated.
+				break;
+			}
+
+			area -= GetArea(m_levels[*largest]);
+			++m_levels[*largest];
+			area += GetArea(m_levels[*largest]);
+		}
+
+		// Allocating power-of-two tiles largest first does not fragment the
+		// quadtree.
+		std::stable_sort(m_order.begin(), m_order.end(),
+			[this](std::size_t lhs, std::size_t rhs) noexcept {
+				return m_levels[lhs] < m_levels[rhs];
+			});
+
+		for (const auto i : m_order) {
+			U32 node = 0u;
+			if (Allocate(0u, 0u, m_levels[i], node)) {
+				m_allocations.emplace(requests[i].m_key,
+									  Allocation{ m_levels[i], node, true, false });
+				tiles[i] = GetTile(m_levels[i], node);
+			}
+			else {
+				tiles[i] = ShadowAtlasTile();
+			}
+		}
+	}
+
+	void ShadowAtlasPacker::Clear() noexcept {
+		std::fill(m_states.begin(), m_states.end(), NodeState::Free);
+		m_allocations.clear();
+	}
+
+	[[nodiscard]]
+	U32 ShadowAtlasPacker::GetLevel(F32 importance) const noexcept {
+		if (importance <= 0.0f) {
+			return m_max_level;
+		}
+
+		const auto nb_levels = static_cast< F32 >(m_max_level - m_min_level);
+		const auto offset    = std::clamp(std::floor(-std::log2(importance)),
+										  0.0f, nb_levels);
+		return m_min_level + static_cast< U32 >(offset);
+	}
+
+	[[nodiscard]]
+	ShadowAtlasPacker::NodeState& ShadowAtlasPacker
+		::GetState(U32 level, U32 node) noexcept {
+
+		return m_states[GetLevelOffset(level) + node];
+	}
+
+	[[nodiscard]]
+	bool ShadowAtlasPacker::Allocate(U32 level, U32 node,
+									 U32 target_level, U32& target_node) noexcept {
+		auto& state = GetState(level, node);
+
+		if (level == target_level) {
+			if (NodeState::Free != state) {
+				return false;
+			}
+
+			state = NodeState::Allocated;
+			target_node = node;
+			return true;
+		}
+
+		switch (state) {
+
+		case NodeState::Free: {
+			state = NodeState::Split;
+			return Allocate(level + 1u, 4u * node, target_level, target_node);
+		}
+
+		case NodeState::Split: {
+			// Prefer split children to keep large free nodes intact.
+			for (const auto child_state : { NodeState::Split, NodeState::Free }) {
+				for (auto child = 4u * node; child < 4u * node + 4u; ++child) {
+					if (child_state == GetState(level + 1u, child)
+						&& Allocate(level + 1u, child, target_level, target_node)) {
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+		default: {
+			return false;
+		}
+
+		}
+	}
+
+	void ShadowAtlasPacker::Release(U32 level, U32 node) noexcept {
+		GetState(level, node) = NodeState::Free;
+
+		// Merge the free siblings.
+		while (0u != level) {
+			const auto first = node & ~3u;
+			for (auto sibling = first; sibling < first + 4u; ++sibling) {
+				if (NodeState::Free != GetState(level, sibling)) {
+					return;
+				}
+			}
+
+			--level;
+			node >>= 2u;
+			GetState(level, node) = NodeState::Free;
+		}
+	}
+
+	[[nodiscard]]
+	const ShadowAtlasTile ShadowAtlasPacker::GetTile(U32 level,
+													 U32 node) const noexcept {
+		const auto resolution = m_resolution >> level;
+
+		ShadowAtlasTile tile;
+		tile.m_top_left    = U32x2(CompactBits(node)      * resolution,
+								   CompactBits(node >> 1u) * resolution);
+		tile.m_resolution  = resolution;
+		tile.m_reallocated = true;
+		return tile;
+	}
+}
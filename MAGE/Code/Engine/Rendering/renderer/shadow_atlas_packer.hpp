@@ -0,0 +1,427 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasRequest
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow atlas requests.
+	 */
+	struct ShadowAtlasRequest {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The key (i.e. the guid of the light) of this shadow atlas request.
+		 */
+		U64 m_key = 0u;
+
+		/**
+		 The screen-space importance of this shadow atlas request in the
+		 range [0,1].
+		 */
+		F32 m_importance = 0.0f;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasTile
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow atlas tiles.
+	 */
+	struct ShadowAtlasTile {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The top left texel of this shadow atlas tile.
+		 */
+		U32x2 m_top_left = {};
+
+		/**
+		 The resolution of this shadow atlas tile (or zero if no tile could be
+		 allocated).
+		 */
+		U32 m_resolution = 0u;
+
+		/**
+		 A flag indicating whether this shadow atlas tile is (re)allocated
+		 (i.e. its previous content is invalid).
+		 */
+		bool m_reallocated = true;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasPacker
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shadow atlas packers.
+
+	 A shadow atlas packer partitions a square shadow atlas with a quadtree
+	 into square tiles whose resolution is a power-of-two fraction of the
+	 resolution of the shadow atlas. The resolution of the tile of each
+	 request is derived from the screen-space importance of that request.
+	 Tiles are retained across packs for requests with the same key, as long
+	 as their resolution does not deviate more than a factor of two from the
+	 requested resolution. If a request cannot be allocated, the complete
+	 shadow atlas is repacked from scratch (largest tiles first), and tiles
+	 are downsized until all requests fit.
+
+	 A shadow atlas packer does not access the GPU.
+	 */
+	class ShadowAtlasPacker {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the screen-space importance of the given bounding sphere
+		 (i.e. the radius of the projected bounding sphere expressed in NDC
+		 space, clamped to the range [0,1]).
+
+		 @param[in]		sphere
+						A reference to the bounding sphere expressed in world
+						space.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @return		The screen-space importance of the given bounding
+						sphere.
+		 */
+		[[nodiscard]]
+		static F32 XM_CALLCONV GetImportance(const BoundingSphere& sphere,
+											 FXMMATRIX world_to_camera,
+											 CXMMATRIX camera_to_projection) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow atlas packer.
+
+		 @pre			@a resolution, @a min_tile_resolution and
+						@a max_tile_resolution are powers of two.
+		 @pre			@a min_tile_resolution is not larger than
+						@a max_tile_resolution.
+		 @pre			@a max_tile_resolution is not larger than
+						@a resolution.
+		 @param[in]		resolution
+						The resolution of the shadow atlas.
+		 @param[in]		min_tile_resolution
+						The minimum resolution of a tile.
+		 @param[in]		max_tile_resolution
+						The maximum resolution of a tile.
+		 */
+		explicit ShadowAtlasPacker(U32 resolution          = 4096u,
+								   U32 min_tile_resolution = 128u,
+								   U32 max_tile_resolution = 2048u);
+
+		/**
+		 Constructs a shadow atlas packer from the given shadow atlas packer.
+
+		 @param[in]		packer
+						A reference to the shadow atlas packer to copy.
+		 */
+		ShadowAtlasPacker(const ShadowAtlasPacker& packer);
+
+		/**
+		 Constructs a shadow atlas packer by moving the given shadow atlas
+		 packer.
+
+		 @param[in]		packer
+						A reference to the shadow atlas packer to move.
+		 */
+		ShadowAtlasPacker(ShadowAtlasPacker&& packer) noexcept;
+
+		/**
+		 Destructs this shadow atlas packer.
+		 */
+		~ShadowAtlasPacker();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow atlas packer to this shadow atlas packer.
+
+		 @param[in]		packer
+						A reference to the shadow atlas packer to copy.
+		 @return		A reference to the copy of the given shadow atlas
+						packer (i.e. this shadow atlas packer).
+		 */
+		ShadowAtlasPacker& operator=(const ShadowAtlasPacker& packer);
+
+		/**
+		 Moves the given shadow atlas packer to this shadow atlas packer.
+
+		 @param[in]		packer
+						A reference to the shadow atlas packer to move.
+		 @return		A reference to the moved shadow atlas packer (i.e.
+						this shadow atlas packer).
+		 */
+		ShadowAtlasPacker& operator=(ShadowAtlasPacker&& packer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the resolution of the shadow atlas of this shadow atlas
+		 packer.
+
+		 @return		The resolution of the shadow atlas of this shadow
+						atlas packer.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the tile resolution of the given screen-space importance.
+
+		 @param[in]		importance
+						The screen-space importance in the range [0,1].
+		 @return		The tile resolution of @a importance.
+		 */
+		[[nodiscard]]
+		U32 GetTileResolution(F32 importance) const noexcept {
+			return m_resolution >> GetLevel(importance);
+		}
+
+		/**
+		 Packs the given requests. The allocations of keys which are not
+		 requested anymore are released.
+
+		 @pre			The keys of @a requests are unique.
+		 @param[in]		requests
+						A reference to a vector containing the requests.
+		 @param[out]	tiles
+						A reference to a vector which will contain the tile
+						of each request.
+		 */
+		void Pack(const std::vector< ShadowAtlasRequest >& requests,
+				  std::vector< ShadowAtlasTile >& tiles);
+
+		/**
+		 Releases all allocations of this shadow atlas packer.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the states of quadtree nodes.
+		 */
+		enum class NodeState : U8 {
+			Free = 0,
+			Split,
+			Allocated
+		};
+
+		/**
+		 A struct of allocations.
+		 */
+		struct Allocation {
+
+			/**
+			 The level of the node of this allocation.
+			 */
+			U32 m_level;
+
+			/**
+			 The index of the node of this allocation within its level.
+			 */
+			U32 m_node;
+
+			/**
+			 A flag indicating whether this allocation is requested by the
+			 current pack.
+			 */
+			bool m_requested;
+
+			/**
+			 A flag indicating whether the tile of this allocation is too
+			 small for the current pack.
+			 */
+			bool m_upgrade;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the quadtree level of the given screen-space importance.
+
+		 @param[in]		importance
+						The screen-space importance in the range [0,1].
+		 @return		The quadtree level of @a importance.
+		 */
+		[[nodiscard]]
+		U32 GetLevel(F32 importance) const noexcept;
+
+		/**
+		 Returns the state of the given quadtree node.
+
+		 @param[in]		level
+						The level of the node.
+		 @param[in]		node
+						The index of the node within its level.
+		 @return		A reference to the state of the given quadtree node.
+		 */
+		[[nodiscard]]
+		NodeState& GetState(U32 level, U32 node) noexcept;
+
+		/**
+		 Allocates a node of the given level in the subtree of the given
+		 quadtree node.
+
+		 @param[in]		level
+						The level of the root node of the subtree.
+		 @param[in]		node
+						The index of the root node of the subtree within its
+						level.
+		 @param[in]		target_level
+						The level of the node to allocate.
+		 @param[out]	target_node
+						A reference to the index of the allocated node within
+						its level.
+		 @return		@c true if a node is allocated. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Allocate(U32 level, U32 node,
+					  U32 target_level, U32& target_node) noexcept;
+
+		/**
+		 Releases the given quadtree node and merges its free ancestors.
+
+		 @param[in]		level
+						The level of the node.
+		 @param[in]		node
+						The index of the node within its level.
+		 */
+		void Release(U32 level, U32 node) noexcept;
+
+		/**
+		 Returns the tile of the given quadtree node.
+
+		 @param[in]		level
+						The level of the node.
+		 @param[in]		node
+						The index of the node within its level.
+		 @return		The tile of the given quadtree node.
+		 */
+		[[nodiscard]]
+		const ShadowAtlasTile GetTile(U32 level, U32 node) const noexcept;
+
+		/**
+		 Repacks the given requests from scratch. The tiles are downsized
+		 (largest tiles first) until all tiles fit in the shadow atlas.
+
+		 @param[in]		requests
+						A reference to a vector containing the requests.
+		 @param[out]	tiles
+						A reference to a vector containing the tile of each
+						request.
+		 */
+		void Repack(const std::vector< ShadowAtlasRequest >& requests,
+					std::vector< ShadowAtlasTile >& tiles);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The resolution of the shadow atlas of this shadow atlas packer.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The quadtree level of the maximum tile resolution of this shadow
+		 atlas packer.
+		 */
+		U32 m_min_level;
+
+		/**
+		 The quadtree level of the minimum tile resolution of this shadow
+		 atlas packer.
+		 */
+		U32 m_max_level;
+
+		/**
+		 A vector containing the state of each quadtree node of this shadow
+		 atlas packer (level by level).
+		 */
+		std::vector< NodeState > m_states;
+
+		/**
+		 The allocations of this shadow atlas packer mapped by key.
+		 */
+		std::unordered_map< U64, Allocation > m_allocations;
+
+		/**
+		 A vector containing the indices of the requests which are currently
+		 packed by this shadow atlas packer (in packing order).
+		 */
+		std::vector< std::size_t > m_order;
+
+		/**
+		 A vector containing the quadtree level of each request which is
+		 currently repacked by this shadow atlas packer.
+		 */
+		std::vector< U32 > m_levels;
+	};
+
+	#pragma endregion
+}
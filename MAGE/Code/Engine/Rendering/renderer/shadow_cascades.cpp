@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow_cascades.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Returns the squared half diagonal of the view frustum of the given
+		 camera at the given depth.
+
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		z
+						The depth expressed in camera space.
+		 @return		The squared half diagonal of the view frustum at
+						depth @a z.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV GetSqrHalfDiagonal(FXMMATRIX camera_to_projection,
+										   F32 z) noexcept {
+
+			const auto w = z * XMVectorGetW(camera_to_projection.r[2])
+				             + XMVectorGetW(camera_to_projection.r[3]);
+			const auto x = w / XMVectorGetX(camera_to_projection.r[0]);
+			const auto y = w / XMVectorGetY(camera_to_projection.r[1]);
+			return x * x + y * y;
+		}
+
+		/**
+		 Returns the world-to-light transformation matrix of the shadow
+		 cascades of the given light direction. This transformation matrix
+		 only contains a rotation to keep the shadow map texels at fixed
+		 world space positions.
+
+		 @param[in]		d_world
+						The (normalized) light direction expressed in world
+						space.
+		 @return		The world-to-light transformation matrix of the
+						shadow cascades.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetWorldToLightMatrix(FXMVECTOR d_world) noexcept {
+			const auto up = (0.99f < std::abs(XMVectorGetY(d_world)))
+				          ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f)
+				          : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+			return XMMatrixLookToLH(g_XMZero, d_world, up);
+		}
+	}
+
+	[[nodiscard]]
+	const std::array< F32, SHADOW_CASCADE_COUNT + 1 >
+		GetShadowCascadeSplits(const F32x2& clipping_planes,
+							   F32 lambda) noexcept {
+
+		const auto [near_plane, far_plane] = clipping_planes;
+
+		std::array< F32, SHADOW_CASCADE_COUNT + 1 > splits;
+		for (std::size_t i = 0u; i < splits.size(); ++i) {
+			const auto f = static_cast< F32 >(i) / SHADOW_CASCADE_COUNT;
+			const auto z_log = near_plane * std::pow(far_plane / near_plane, f);
+			const auto z_uni = near_plane + (far_plane - near_plane) * f;
+			splits[i] = lambda * z_log + (1.0f - lambda) * z_uni;
+		}
+
+		// Avoid gaps due to rounding errors.
+		splits.front() = near_plane;
+		splits.back()  = far_plane;
+
+		return splits;
+	}
+
+	[[nodiscard]]
+	const BoundingSphere XM_CALLCONV
+		GetShadowCascadeSphere(FXMMATRIX camera_to_projection,
+							   F32 z_near, F32 z_far) noexcept {
+
+		const auto sqr_h_near = GetSqrHalfDiagonal(camera_to_projection, z_near);
+		const auto sqr_h_far  = GetSqrHalfDiagonal(camera_to_projection, z_far);
+
+		// The center on the z axis which is equidistant to the corners of the
+		// near and far plane of the depth slice (clamped to the depth slice).
+		const auto z = std::clamp((z_far * z_far - z_near * z_near
+								   + sqr_h_far - sqr_h_near)
+								  / (2.0f * (z_far - z_near)), z_near, z_far);
+
+		const auto sqr_r = std::max(sqr_h_near + (z - z_near) * (z - z_near),
+									sqr_h_far  + (z_far - z) * (z_far - z));
+
+		// Round the radius up to absorb floating-point noise, which would
+		// otherwise change the texel size between frames.
+		const auto r = std::ceil(std::sqrt(sqr_r) * 16.0f) / 16.0f;
+
+		return BoundingSphere(XMVectorSet(0.0f, 0.0f, z, 1.0f), r);
+	}
+
+	void XM_CALLCONV FitShadowCascades(FXMMATRIX light_to_world,
+									   CXMMATRIX world_to_camera,
+									   CXMMATRIX camera_to_projection,
+									   const AABB& light_aabb,
+									   const F32x2& clipping_planes,
+									   U32 resolution,
+									   ShadowCascade* cascades,
+									   F32 lambda) noexcept {
+
+		const auto camera_to_world = XMMatrixInverse(nullptr, world_to_camera);
+		const auto world_to_light
+			= GetWorldToLightMatrix(XMVector3Normalize(light_to_world.r[2]));
+
+		// The depth range of the light volume expressed in light space of
+		// the shadow cascades.
+		const auto light_to_cascade = light_to_world * world_to_light;
+		const auto p_min = light_aabb.MinPoint();
+		const auto p_max = light_aabb.MaxPoint();
+		auto z_min =  std::numeric_limits< F32 >::max();
+		auto z_max = -std::numeric_limits< F32 >::max();
+		for (U32 i = 0u; i < 8u; ++i) {
+			const auto p = XMVectorSelect(p_min, p_max,
+										  XMVectorSelectControl(i & 1u,
+																(i >> 1u) & 1u,
+																(i >> 2u) & 1u,
+																0u));
+			const auto z = XMVectorGetZ(XMVector3TransformCoord(p, light_to_cascade));
+			z_min = std::min(z_min, z);
+			z_max = std::max(z_max, z);
+		}
+
+		#ifdef DISABLE_INVERTED_Z_BUFFER
+		const auto near_plane = z_min;
+		const auto far_plane  = z_max;
+		#else  // DISABLE_INVERTED_Z_BUFFER
+		const auto near_plane = z_max;
+		const auto far_plane  = z_min;
+		#endif // DISABLE_INVERTED_Z_BUFFER
+
+		const auto splits = GetShadowCascadeSplits(clipping_planes, lambda);
+		for (std::size_t i = 0u; i < SHADOW_CASCADE_COUNT; ++i) {
+			const auto sphere = GetShadowCascadeSphere(camera_to_projection,
+													   splits[i], splits[i + 1u]);
+			const auto r = sphere.Radius();
+
+			// Snap the center of the shadow cascade to the shadow map texels.
+			const auto p_world = XMVector3TransformCoord(sphere.Centroid(),
+														 camera_to_world);
+			const auto p_light = XMVector3TransformCoord(p_world, world_to_light);
+			const auto texel_size = 2.0f * r / resolution;
+			const auto x = std::floor(XMVectorGetX(p_light) / texel_size) * texel_size;
+			const auto y = std::floor(XMVectorGetY(p_light) / texel_size) * texel_size;
+
+			auto& cascade = cascades[i];
+			cascade.m_world_to_light      = world_to_light;
+			cascade.m_light_to_projection = XMMatrixOrthographicOffCenterLH(
+				x - r, x + r, y - r, y + r, near_plane, far_plane);
+		}
+	}
+}
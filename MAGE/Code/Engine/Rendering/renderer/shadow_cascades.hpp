@@ -0,0 +1,149 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShadowCascade
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow cascades.
+
+	 A shadow cascade is the orthographic light camera of a directional light
+	 covering one depth slice of the view frustum of a camera.
+	 */
+	struct alignas(16) ShadowCascade {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The world-to-light transformation matrix of this shadow cascade.
+		 */
+		XMMATRIX m_world_to_light;
+
+		/**
+		 The light-to-projection transformation matrix of this shadow cascade.
+		 */
+		XMMATRIX m_light_to_projection;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shadow Cascade Utilities
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the split depths of the shadow cascades of the given camera using
+	 the practical split scheme (i.e. a blend between the uniform and the
+	 logarithmic split scheme).
+
+	 @param[in]		clipping_planes
+					A reference to the clipping planes of the camera expressed
+					in camera space.
+	 @param[in]		lambda
+					The weight of the logarithmic split scheme in the range
+					[0,1].
+	 @return		The split depths expressed in camera space. The i-th
+					shadow cascade covers the depth range [splits[i],
+					splits[i+1]].
+	 */
+	[[nodiscard]]
+	const std::array< F32, SHADOW_CASCADE_COUNT + 1 >
+		GetShadowCascadeSplits(const F32x2& clipping_planes,
+							   F32 lambda) noexcept;
+
+	/**
+	 Returns the bounding sphere of the given depth slice of the view frustum
+	 of the given camera. The bounding sphere only depends on the shape of the
+	 view frustum, and is thus invariant under camera rotations.
+
+	 @pre			The view frustum of the camera is symmetric.
+	 @param[in]		camera_to_projection
+					The camera-to-projection transformation matrix.
+	 @param[in]		z_near
+					The near depth of the depth slice expressed in camera
+					space.
+	 @param[in]		z_far
+					The far depth of the depth slice expressed in camera
+					space.
+	 @return		The bounding sphere of the given depth slice expressed
+					in camera space.
+	 */
+	[[nodiscard]]
+	const BoundingSphere XM_CALLCONV
+		GetShadowCascadeSphere(FXMMATRIX camera_to_projection,
+							   F32 z_near, F32 z_far) noexcept;
+
+	/**
+	 Fits the shadow cascades of the given directional light to the view
+	 frustum of the given camera.
+
+	 Each shadow cascade bounds the bounding sphere of its depth slice, and
+	 its origin is snapped to the shadow map texels, which avoids shimmering
+	 shadow edges under camera translations and rotations. The depth range of
+	 each shadow cascade covers the complete light volume, which includes all
+	 shadow casters between the light and the depth slice.
+
+	 @param[in]		light_to_world
+					The light-to-world transformation matrix of the
+					directional light (whose light direction is the z axis).
+	 @param[in]		world_to_camera
+					The world-to-camera transformation matrix.
+	 @param[in]		camera_to_projection
+					The camera-to-projection transformation matrix.
+	 @param[in]		light_aabb
+					A reference to the AABB of the light volume expressed in
+					light space.
+	 @param[in]		clipping_planes
+					A reference to the clipping planes of the camera expressed
+					in camera space.
+	 @param[in]		resolution
+					The resolution of the shadow maps of the shadow cascades.
+	 @param[out]	cascades
+					A pointer to the @c SHADOW_CASCADE_COUNT shadow cascades.
+	 @param[in]		lambda
+					The weight of the logarithmic split scheme in the range
+					[0,1].
+	 */
+	void XM_CALLCONV FitShadowCascades(FXMMATRIX light_to_world,
+									   CXMMATRIX world_to_camera,
+									   CXMMATRIX camera_to_projection,
+									   const AABB& light_aabb,
+									   const F32x2& clipping_planes,
+									   U32 resolution,
+									   ShadowCascade* cascades,
+									   F32 lambda = 0.75f) noexcept;
+
+	#pragma endregion
+}
@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow_caster_cache.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Checks whether the given transformation matrices are equal.
+
+		 @param[in]		lhs
+						The first transformation matrix.
+		 @param[in]		rhs
+						The second transformation matrix.
+		 @return		@c true if @a lhs is equal to @a rhs. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Equal(FXMMATRIX lhs, CXMMATRIX rhs) noexcept {
+			return XMVector4Equal(lhs.r[0], rhs.r[0])
+				&& XMVector4Equal(lhs.r[1], rhs.r[1])
+				&& XMVector4Equal(lhs.r[2], rhs.r[2])
+				&& XMVector4Equal(lhs.r[3], rhs.r[3]);
+		}
+	}
+
+	ShadowCasterCache::ShadowCasterCache()
+		: m_entries(),
+		m_visibility(),
+		m_candidates() {}
+
+	ShadowCasterCache::ShadowCasterCache(
+		ShadowCasterCache&& cache) noexcept = default;
+
+	ShadowCasterCache::~ShadowCasterCache() = default;
+
+	ShadowCasterCache& ShadowCasterCache
+		::operator=(ShadowCasterCache&& cache) noexcept = default;
+
+	void ShadowCasterCache::Reset(std::size_t nb_shadow_maps) {
+		m_entries.clear();
+		m_entries.resize(nb_shadow_maps);
+	}
+
+	void ShadowCasterCache::Resize(std::size_t nb_shadow_maps) {
+		m_entries.resize(nb_shadow_maps);
+	}
+
+	void XM_CALLCONV ShadowCasterCache::Gather(std::size_t index,
+											   const RenderFrame& frame,
+											   FXMMATRIX world_to_projection) {
+
+		auto& entry = m_entries[index];
+		if (Reuse(entry, frame, world_to_projection)) {
+			return;
+		}
+
+		// Cull the models against the light frustum.
+		const BoundingFrustum frustum(world_to_projection);
+		frame.GetModelCuller().Cull(frustum, m_visibility);
+
+		m_candidates.clear();
+		m_visibility.ForEach([this](std::size_t i) {
+			m_candidates.push_back(static_cast< U32 >(i));
+		});
+
+		Gather(entry, frame, world_to_projection, m_candidates, nullptr);
+	}
+
+	void ShadowCasterCache::GatherCube(std::size_t index,
+									   const RenderFrame& frame,
+									   const BoundingSphere& sphere,
+									   const XMMATRIX* world_to_projections) {
+
+		bool reused[6];
+		bool all_reused = true;
+		for (std::size_t i = 0u; i < std::size(reused); ++i) {
+			reused[i] = Reuse(m_entries[index + i], frame,
+							  world_to_projections[i]);
+			all_reused &= reused[i];
+		}
+
+		if (all_reused) {
+			return;
+		}
+
+		// Cull the models against the light sphere.
+		frame.GetModelCuller().Cull(sphere, m_visibility);
+
+		m_candidates.clear();
+		m_visibility.ForEach([this](std::size_t i) {
+			m_candidates.push_back(static_cast< U32 >(i));
+		});
+
+		// Cull the overlapping models against the light frustum of each face.
+		for (std::size_t i = 0u; i < std::size(reused); ++i) {
+			if (reused[i]) {
+				continue;
+			}
+
+			const BoundingFrustum frustum(world_to_projections[i]);
+			Gather(m_entries[index + i], frame, world_to_projections[i],
+				   m_candidates, &frustum);
+		}
+	}
+
+	void XM_CALLCONV ShadowCasterCache::Gather(Entry& entry,
+											   const RenderFrame& frame,
+											   FXMMATRIX world_to_projection,
+											   const std::vector< U32 >& candidates,
+											   const BoundingFrustum* frustum) {
+
+		const auto& culler          = frame.GetModelCuller();
+		const auto& classifications = frame.GetModelClassifications();
+		const auto& versions        = frame.GetModelVersions();
+
+		auto& casters = entry.m_casters;
+		casters.m_opaque_models.clear();
+		casters.m_transparent_models.clear();
+		entry.m_gathered_keys.clear();
+
+		for (const auto i : candidates) {
+			const auto& classification = classifications[i];
+			const auto  opaque = classification.Contains(ModelBucket::DepthOpaque);
+
+			if (!classification.m_occludes_light
+				|| !(opaque || classification.Contains(ModelBucket::DepthTransparent))) {
+				continue;
+			}
+
+			if (frustum && !frustum->Overlaps(culler.GetWorldAABB(i))) {
+				continue;
+			}
+
+			auto& models = opaque ? casters.m_opaque_models
+								  : casters.m_transparent_models;
+			models.push_back(i);
+			entry.m_gathered_keys.emplace_back(&culler.GetModel(i), versions[i]);
+		}
+
+		// The shadow map only needs to be rendered if the light camera or
+		// its shadow casters changed.
+		entry.m_dirty = !entry.m_valid
+			|| !Equal(entry.m_world_to_projection, world_to_projection)
+			|| entry.m_keys != entry.m_gathered_keys;
+
+		entry.m_keys.swap(entry.m_gathered_keys);
+		entry.m_world_to_projection = world_to_projection;
+		entry.m_models_version      = frame.GetModelsVersion();
+		entry.m_valid               = true;
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV ShadowCasterCache::Reuse(Entry& entry,
+											  const RenderFrame& frame,
+											  FXMMATRIX world_to_projection) noexcept {
+
+		// The models (and thus the indices of the shadow casters) did not
+		// change since the shadow casters were gathered.
+		if (!entry.m_valid
+			|| entry.m_models_version != frame.GetModelsVersion()
+			|| !Equal(entry.m_world_to_projection, world_to_projection)) {
+			return false;
+		}
+
+		entry.m_dirty = false;
+		return true;
+	}
+}
@@ -0,0 +1,341 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\render_frame.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShadowCasters
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow caster lists.
+
+	 A shadow caster list contains the indices of the models of a model culler
+	 which occlude light and overlap the view frustum of a light camera.
+	 */
+	struct ShadowCasters {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the indices of the opaque shadow casters.
+		 */
+		std::vector< U32 > m_opaque_models;
+
+		/**
+		 A vector containing the indices of the transparent shadow casters.
+		 */
+		std::vector< U32 > m_transparent_models;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShadowCasterCache
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shadow caster caches.
+
+	 A shadow caster cache contains the shadow caster list of each shadow map
+	 of a shadow map buffer, and retains these lists across frames. The shadow
+	 caster list of a shadow map is reused as long as neither the light camera
+	 nor any model changed. Otherwise, the shadow caster list is gathered
+	 again, and the shadow map is only marked dirty (i.e. needs to be
+	 rendered) if the light camera or its shadow casters changed.
+	 */
+	class ShadowCasterCache {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow caster cache.
+		 */
+		ShadowCasterCache();
+
+		/**
+		 Constructs a shadow caster cache from the given shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to copy.
+		 */
+		ShadowCasterCache(const ShadowCasterCache& cache) = delete;
+
+		/**
+		 Constructs a shadow caster cache by moving the given shadow caster
+		 cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to move.
+		 */
+		ShadowCasterCache(ShadowCasterCache&& cache) noexcept;
+
+		/**
+		 Destructs this shadow caster cache.
+		 */
+		~ShadowCasterCache();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow caster cache to this shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to copy.
+		 @return		A reference to the copy of the given shadow caster
+						cache (i.e. this shadow caster cache).
+		 */
+		ShadowCasterCache& operator=(const ShadowCasterCache& cache) = delete;
+
+		/**
+		 Moves the given shadow caster cache to this shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to move.
+		 @return		A reference to the moved shadow caster cache (i.e.
+						this shadow caster cache).
+		 */
+		ShadowCasterCache& operator=(ShadowCasterCache&& cache) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Resets this shadow caster cache to the given number of dirty shadow
+		 maps.
+
+		 @param[in]		nb_shadow_maps
+						The number of shadow maps.
+		 */
+		void Reset(std::size_t nb_shadow_maps);
+
+		/**
+		 Resizes this shadow caster cache to the given number of shadow maps.
+		 The entries of the retained shadow maps are preserved, and the added
+		 shadow maps are dirty.
+
+		 @param[in]		nb_shadow_maps
+						The number of shadow maps.
+		 */
+		void Resize(std::size_t nb_shadow_maps);
+
+		/**
+		 Gathers the shadow casters of the given shadow map.
+
+		 @pre			@a index is smaller than the number of shadow maps of
+						this shadow caster cache.
+		 @param[in]		index
+						The index of the shadow map.
+		 @param[in]		frame
+						A reference to the render frame.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						light camera of the shadow map.
+		 */
+		void XM_CALLCONV Gather(std::size_t index,
+								const RenderFrame& frame,
+								FXMMATRIX world_to_projection);
+
+		/**
+		 Gathers the shadow casters of the six faces of the given shadow cube
+		 map. The models are culled once against the given bounding sphere,
+		 and only the overlapping models are tested against the view frustum
+		 of each face.
+
+		 @pre			@a index + 5 is smaller than the number of shadow
+						maps of this shadow caster cache.
+		 @param[in]		index
+						The index of the shadow map of the first face.
+		 @param[in]		frame
+						A reference to the render frame.
+		 @param[in]		sphere
+						A reference to the bounding sphere of the light
+						expressed in world space.
+		 @param[in]		world_to_projections
+						A pointer to the world-to-projection transformation
+						matrices of the light cameras of the six faces.
+		 */
+		void GatherCube(std::size_t index,
+						const RenderFrame& frame,
+						const BoundingSphere& sphere,
+						const XMMATRIX* world_to_projections);
+
+		/**
+		 Checks whether the given shadow map of this shadow caster cache is
+		 dirty.
+
+		 @pre			@a index is smaller than the number of shadow maps of
+						this shadow caster cache.
+		 @param[in]		index
+						The index of the shadow map.
+		 @return		@c true if the given shadow map needs to be
+						rendered. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirty(std::size_t index) const noexcept {
+			return m_entries[index].m_dirty;
+		}
+
+		/**
+		 Returns the shadow casters of the given shadow map of this shadow
+		 caster cache.
+
+		 @pre			@a index is smaller than the number of shadow maps of
+						this shadow caster cache.
+		 @param[in]		index
+						The index of the shadow map.
+		 @return		A reference to the shadow casters of the given shadow
+						map.
+		 */
+		[[nodiscard]]
+		const ShadowCasters& GetCasters(std::size_t index) const noexcept {
+			return m_entries[index].m_casters;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shadow caster cache entries.
+		 */
+		struct alignas(16) Entry {
+
+			/**
+			 The world-to-projection transformation matrix of the light
+			 camera of this entry.
+			 */
+			XMMATRIX m_world_to_projection = XMMatrixIdentity();
+
+			/**
+			 The version of the models of the render frame from which the
+			 shadow casters of this entry are gathered.
+			 */
+			U64 m_models_version = 0u;
+
+			/**
+			 The shadow casters of this entry.
+			 */
+			ShadowCasters m_casters;
+
+			/**
+			 A vector containing the model and model version of each shadow
+			 caster of this entry.
+			 */
+			std::vector< std::pair< const Model*, U64 > > m_keys;
+
+			/**
+			 A vector containing the model and model version of each
+			 shadow caster which is currently gathered.
+			 */
+			std::vector< std::pair< const Model*, U64 > > m_gathered_keys;
+
+			/**
+			 A flag indicating whether this entry is valid.
+			 */
+			bool m_valid = false;
+
+			/**
+			 A flag indicating whether the shadow map of this entry is dirty.
+			 */
+			bool m_dirty = true;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Gathers the shadow casters of the given entry from the given
+		 candidate models.
+
+		 @param[in,out]	entry
+						A reference to the entry.
+		 @param[in]		frame
+						A reference to the render frame.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						light camera of the entry.
+		 @param[in]		candidates
+						A reference to a vector containing the indices of the
+						candidate models.
+		 @param[in]		frustum
+						A pointer to the view frustum of the light camera of
+						the entry to test the candidate models against, or
+						@c nullptr if the candidate models are already culled.
+		 */
+		static void XM_CALLCONV Gather(Entry& entry,
+									   const RenderFrame& frame,
+									   FXMMATRIX world_to_projection,
+									   const std::vector< U32 >& candidates,
+									   const BoundingFrustum* frustum);
+
+		/**
+		 Checks whether the given entry can be reused for the given light
+		 camera and render frame, and marks the entry clean if so.
+
+		 @param[in,out]	entry
+						A reference to the entry.
+		 @param[in]		frame
+						A reference to the render frame.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						light camera of the entry.
+		 @return		@c true if the given entry can be reused. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		static bool XM_CALLCONV Reuse(Entry& entry,
+									  const RenderFrame& frame,
+									  FXMMATRIX world_to_projection) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The entries of this shadow caster cache.
+		 */
+		AlignedVector< Entry > m_entries;
+
+		/**
+		 The visibility mask of the models for the bounding volume which is
+		 currently culled by this shadow caster cache.
+		 */
+		VisibilityMask m_visibility;
+
+		/**
+		 The indices of the models overlapping the bounding sphere which is
+		 currently culled by this shadow caster cache.
+		 */
+		std::vector< U32 > m_candidates;
+	};
+
+	#pragma endregion
+}
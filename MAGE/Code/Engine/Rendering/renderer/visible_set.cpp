@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\visible_set.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ModelClassification
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	namespace {
+
+		/**
+		 Returns the bit of the given bucket.
+
+		 @param[in]		bucket
+						The bucket.
+		 @return		The bit of @a bucket.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetBit(ModelBucket bucket) noexcept {
+			return 1u << static_cast< U32 >(bucket);
+		}
+
+		/**
+		 The buckets which are sorted back-to-front.
+		 */
+		constexpr U32 g_back_to_front_buckets
+			= GetBit(ModelBucket::Transparent)
+			| GetBit(ModelBucket::TransparentTSNM)
+			| GetBit(ModelBucket::TransparentEmissive)
+			| GetBit(ModelBucket::DepthTransparent);
+	}
+
+	[[nodiscard]]
+	const ModelClassification ModelClassification
+		::Get(const Model& model) noexcept {
+
+		const auto& material    = model.GetMaterial();
+		const auto  alpha       = material.GetBaseColor()[3];
+		const auto  emissive    = material.IsEmissive();
+		const auto  tsnm        = (nullptr != material.GetNormalSRV());
+		const auto  transparent = material.IsTransparant();
+
+		ModelClassification classification;
+		classification.m_state_key      = DrawList::GetStateKey(model);
+		classification.m_buckets        = GetBit(ModelBucket::All);
+		classification.m_occludes_light = model.OccludesLight();
+
+		if (TRANSPARENCY_THRESHOLD <= alpha) {
+			classification.m_buckets
+				|= GetBit(emissive ? ModelBucket::OpaqueEmissive
+						  : (tsnm  ? ModelBucket::OpaqueTSNM
+								   : ModelBucket::Opaque));
+		}
+
+		if (!transparent) {
+			classification.m_buckets |= GetBit(ModelBucket::DepthOpaque);
+		}
+		else if (TRANSPARENCY_SHADOW_THRESHOLD <= alpha) {
+			classification.m_buckets
+				|= GetBit(ModelBucket::DepthTransparent)
+				 | GetBit(emissive ? ModelBucket::TransparentEmissive
+						  : (tsnm  ? ModelBucket::TransparentTSNM
+								   : ModelBucket::Transparent));
+		}
+
+		return classification;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// VisibleSet
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	VisibleSet::VisibleSet()
+		: m_buckets() {}
+
+	VisibleSet::VisibleSet(VisibleSet&& visible_set) noexcept = default;
+
+	VisibleSet::~VisibleSet() = default;
+
+	VisibleSet& VisibleSet::operator=(VisibleSet&& visible_set) noexcept = default;
+
+	void XM_CALLCONV VisibleSet::Classify(
+		const ModelCuller& culler,
+		const std::vector< ModelClassification >& classifications,
+		const VisibilityMask& visibility,
+		FXMMATRIX world_to_camera) {
+
+		for (auto& bucket : m_buckets) {
+			bucket.Clear();
+		}
+
+		visibility.ForEach([this, &culler, &classifications,
+							world_to_camera](std::size_t index) {
+
+			const auto& model          = culler.GetModel(index);
+			const auto& aabb           = culler.GetWorldAABB(index);
+			const auto& classification = classifications[index];
+
+			const auto p_camera = XMVector3Transform(aabb.Centroid(), world_to_camera);
+			const auto depth    = XMVectorGetZ(p_camera);
+			const auto key      = DrawList::GetKey(classification.m_state_key,
+												   depth, DrawOrder::State);
+			const auto back_to_front_key
+				= (0u != (classification.m_buckets & g_back_to_front_buckets))
+				? DrawList::GetKey(classification.m_state_key,
+								   depth, DrawOrder::BackToFront)
+				: key;
+
+			for (U32 i = 0u; i < static_cast< U32 >(ModelBucket::Count); ++i) {
+				const auto bit = 1u << i;
+				if (0u != (classification.m_buckets & bit)) {
+					const auto bucket_key = (0u != (g_back_to_front_buckets & bit))
+						                  ? back_to_front_key : key;
+					m_buckets[i].Add(model, bucket_key);
+				}
+			}
+		});
+
+		for (auto& bucket : m_buckets) {
+			bucket.Sort();
+		}
+	}
+
+	#pragma endregion
+}
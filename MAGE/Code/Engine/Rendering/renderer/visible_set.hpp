@@ -0,0 +1,310 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\model_culler.hpp"
+#include "renderer\draw_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ModelBucket
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different model buckets of a visible set.
+
+	 This contains:
+	 @c All,
+	 @c Opaque,
+	 @c OpaqueTSNM,
+	 @c OpaqueEmissive,
+	 @c Transparent,
+	 @c TransparentTSNM,
+	 @c TransparentEmissive,
+	 @c DepthOpaque and
+	 @c DepthTransparent.
+
+	 The buckets are not disjoint: a model belongs to each bucket whose
+	 criteria it satisfies.
+	 */
+	enum class ModelBucket : U8 {
+		All = 0,             // All models.
+		Opaque,              // Opaque non-emissive models with no TSNM.
+		OpaqueTSNM,          // Opaque non-emissive models with TSNM.
+		OpaqueEmissive,      // Opaque emissive models.
+		Transparent,         // Transparent non-emissive models with no TSNM.
+		TransparentTSNM,     // Transparent non-emissive models with TSNM.
+		TransparentEmissive, // Transparent emissive models.
+		DepthOpaque,         // Models with a non-transparent material.
+		DepthTransparent,    // Transparent models casting depth.
+		Count
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ModelClassification
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of model classifications.
+
+	 A model classification contains the data of a model needed to classify
+	 that model into the buckets of a visible set. Visible sets are classified
+	 from model classifications, without accessing the models themselves.
+	 */
+	struct ModelClassification {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the model classification of the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @return		The model classification of @a model.
+		 */
+		[[nodiscard]]
+		static const ModelClassification Get(const Model& model) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the model of this model classification belongs to
+		 the given bucket.
+
+		 @param[in]		bucket
+						The bucket.
+		 @return		@c true if the model of this model classification
+						belongs to @a bucket. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Contains(ModelBucket bucket) const noexcept {
+			return 0u != (m_buckets & (1u << static_cast< U32 >(bucket)));
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The state key of the model of this model classification.
+		 */
+		U64 m_state_key = 0u;
+
+		/**
+		 The buckets of the model of this model classification (a bit per
+		 bucket).
+		 */
+		U32 m_buckets = 0u;
+
+		/**
+		 A flag indicating whether the model of this model classification
+		 occludes light (i.e. casts shadows).
+		 */
+		bool m_occludes_light = false;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// VisibleSet
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of visible sets.
+
+	 A visible set contains the models visible to a camera, classified once
+	 per camera and frame into buckets. The passes iterate these buckets
+	 instead of filtering all models of a world over and over again. Each
+	 bucket is a draw list sorted to minimize state changes (opaque buckets)
+	 or sorted back-to-front (transparent buckets).
+	 */
+	class VisibleSet {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a visible set.
+		 */
+		VisibleSet();
+
+		/**
+		 Constructs a visible set from the given visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to copy.
+		 */
+		VisibleSet(const VisibleSet& visible_set) = delete;
+
+		/**
+		 Constructs a visible set by moving the given visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to move.
+		 */
+		VisibleSet(VisibleSet&& visible_set) noexcept;
+
+		/**
+		 Destructs this visible set.
+		 */
+		~VisibleSet();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given visible set to this visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to copy.
+		 @return		A reference to the copy of the given visible set (i.e.
+						this visible set).
+		 */
+		VisibleSet& operator=(const VisibleSet& visible_set) = delete;
+
+		/**
+		 Moves the given visible set to this visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to move.
+		 @return		A reference to the moved visible set (i.e. this
+						visible set).
+		 */
+		VisibleSet& operator=(VisibleSet&& visible_set) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of models in the given bucket of this visible
+		 set.
+
+		 @param[in]		bucket
+						The bucket.
+		 @return		The number of models in @a bucket of this visible
+						set.
+		 */
+		[[nodiscard]]
+		std::size_t size(ModelBucket bucket = ModelBucket::All) const noexcept {
+			return GetBucket(bucket).size();
+		}
+
+		/**
+		 Classifies the visible models of the given model culler.
+
+		 @pre			@a classifications contains the model classification
+						of each model of @a culler.
+		 @param[in]		culler
+						A reference to the model culler.
+		 @param[in]		classifications
+						A reference to a vector containing the model
+						classifications of the models of @a culler.
+		 @param[in]		visibility
+						A reference to the visibility mask of the models of
+						@a culler.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 */
+		void XM_CALLCONV Classify(
+			const ModelCuller& culler,
+			const std::vector< ModelClassification >& classifications,
+			const VisibilityMask& visibility,
+			FXMMATRIX world_to_camera);
+
+		/**
+		 Calls the given action for each model of the given bucket of this
+		 visible set in draw order.
+
+		 @tparam		ActionT
+						An action to perform on each model. The action must
+						accept @c const @c Model& and @c const @c Model*
+						values (i.e. the model and the previously drawn model
+						of the bucket or @c nullptr).
+		 @param[in]		bucket
+						The bucket.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEach(ModelBucket bucket, ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the given bucket of this visible set.
+
+		 @param[in]		bucket
+						The bucket.
+		 @return		A reference to the draw list of @a bucket of this
+						visible set.
+		 */
+		[[nodiscard]]
+		DrawList& GetBucket(ModelBucket bucket) noexcept {
+			return m_buckets[static_cast< std::size_t >(bucket)];
+		}
+
+		/**
+		 Returns the given bucket of this visible set.
+
+		 @param[in]		bucket
+						The bucket.
+		 @return		A reference to the draw list of @a bucket of this
+						visible set.
+		 */
+		[[nodiscard]]
+		const DrawList& GetBucket(ModelBucket bucket) const noexcept {
+			return m_buckets[static_cast< std::size_t >(bucket)];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 An array containing the draw lists of the buckets of this visible
+		 set.
+		 */
+		DrawList m_buckets[
+			static_cast< std::size_t >(ModelBucket::Count)];
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\visible_set.tpp"
+
+#pragma endregion
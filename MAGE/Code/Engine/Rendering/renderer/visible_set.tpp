@@ -0,0 +1,12 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename ActionT >
+	void VisibleSet::ForEach(ModelBucket bucket, ActionT&& action) const {
+		GetBucket(bucket).ForEach(std::forward< ActionT >(action));
+	}
+}
@@ -17,6 +17,12 @@ namespace mage::rendering {
 
 	U32 Pipeline::s_nb_draws = 0u;
 
+	U32 Pipeline::s_nb_binds = 0u;
+
+	U32 Pipeline::s_nb_elided_binds = 0u;
+
+	Pipeline::Bindings Pipeline::s_bindings;
+
 	//-------------------------------------------------------------------------
 	// Manager::Impl
 	//-------------------------------------------------------------------------
@@ -40,9 +46,12 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		display_configuration
 						A reference to the display configuration.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Impl(NotNull< HWND > window,
-					  const DisplayConfiguration& display_configuration);
+					  const DisplayConfiguration& display_configuration,
+					  JobSystem& job_system);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -256,10 +265,16 @@ namespace mage::rendering {
 		 A pointer to the renderer of this rendering manager.
 		 */
 		UniquePtr< Renderer > m_renderer;
+
+		/**
+		 A reference to the job system of this rendering manager.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
 	};
 
 	Manager::Impl::Impl(NotNull< HWND > window,
-						const DisplayConfiguration& configuration)
+						const DisplayConfiguration& configuration,
+						JobSystem& job_system)
 		: m_window(window),
 		m_display_configuration(
 			MakeUnique< DisplayConfiguration >(configuration)),
@@ -269,7 +284,8 @@ namespace mage::rendering {
 		m_swap_chain(),
 		m_resource_manager(),
 		m_world(),
-		m_renderer() {
+		m_renderer(),
+		m_job_system(job_system) {
 
 		InitializeSystems();
 	}
@@ -303,7 +319,8 @@ namespace mage::rendering {
 											*m_device_context.Get(),
 											*m_display_configuration,
 											*m_swap_chain,
-											*m_resource_manager);
+											*m_resource_manager,
+											m_job_system);
 
 		// Setup ImGui.
 		ImGui::CreateContext();
@@ -324,6 +341,7 @@ namespace mage::rendering {
 		// Reset any device context to the default settings.
 		if (m_device_context) {
 			m_device_context->ClearState();
+			Pipeline::InvalidateBindings();
 		}
 	}
 
@@ -378,7 +396,9 @@ namespace mage::rendering {
 
 	void Manager::Impl::Render(const GameTime& time) {
 		m_swap_chain->Clear();
-		Pipeline::s_nb_draws = 0u;
+		Pipeline::s_nb_draws        = 0u;
+		Pipeline::s_nb_binds        = 0u;
+		Pipeline::s_nb_elided_binds = 0u;
 		m_renderer->Render(GetWorld(), time);
 
 		m_swap_chain->Present();
@@ -392,8 +412,9 @@ namespace mage::rendering {
 	#pragma region
 
 	Manager::Manager(NotNull< HWND > window,
-					 const DisplayConfiguration& configuration)
-		: m_impl(MakeUnique< Impl >(window, configuration)) {}
+					 const DisplayConfiguration& configuration,
+					 JobSystem& job_system)
+		: m_impl(MakeUnique< Impl >(window, configuration, job_system)) {}
 
 	Manager::Manager(Manager&& manager) noexcept = default;
 
@@ -9,6 +9,7 @@
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 #include "system\game_timer.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -35,9 +36,12 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		configuration
 						A reference to the display configuration.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 */
 		explicit Manager(NotNull< HWND > window,
-						 const DisplayConfiguration& configuration);
+						 const DisplayConfiguration& configuration,
+						 JobSystem& job_system);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
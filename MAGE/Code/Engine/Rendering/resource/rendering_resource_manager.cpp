@@ -4,6 +4,8 @@
 #pragma region
 
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\texture\texture_factory.hpp"
+#include "io\binary_reader.hpp"
 
 #pragma endregion
 
@@ -22,9 +24,43 @@ namespace mage::rendering {
 		m_ps_pool(),
 		m_cs_pool(),
 		m_sprite_font_pool(),
-		m_texture_pool() {}
-
-	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
+		m_texture_pool(),
+		m_streamer() {}
 
 	ResourceManager::~ResourceManager() = default;
+
+	ResourceManager::future_type< Texture >
+		ResourceManager::StreamTexture(const std::wstring& fname) {
+
+		auto promise = MakeShared< std::promise< TexturePtr > >();
+		future_type< Texture > future(promise->get_future().share(),
+									  CreateWhiteTexture(*this));
+
+		m_streamer.Read([this, fname, promise]() noexcept {
+			try {
+				// Read the file on the I/O thread.
+				UniquePtr< U8[] > data;
+				std::size_t size = 0u;
+				ReadBinaryFile(fname, data, size);
+
+				// Create the texture on a decode thread.
+				m_streamer.Decode([this, fname, promise, size,
+								   data = SharedPtr< U8[] >(std::move(data))]() noexcept {
+					try {
+						promise->set_value(GetPool< Texture >().GetOrCreate(
+							fname, m_device, key_type< Texture >(fname),
+							gsl::span< const U8 >(data.get(), size)));
+					}
+					catch (...) {
+						promise->set_exception(std::current_exception());
+					}
+				});
+			}
+			catch (...) {
+				promise->set_exception(std::current_exception());
+			}
+		});
+
+		return future;
+	}
 }
@@ -5,7 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "resource\resource_future.hpp"
 #include "resource\resource_pool.hpp"
+#include "resource\resource_streamer.hpp"
 #include "resource\model\model_descriptor.hpp"
 #include "resource\shader\shader.hpp"
 #include "resource\font\sprite_font.hpp"
@@ -113,6 +115,15 @@ namespace mage::rendering {
 		template< typename ResourceT >
 		using value_type = typename pool_type< ResourceT >::value_type;
 
+		/**
+		 The future type of resources of the given type.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT >
+		using future_type = ResourceFuture< value_type< ResourceT > >;
+
 		#pragma endregion
 
 		//---------------------------------------------------------------------
@@ -137,11 +148,13 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a resource manager by moving the given resource manager.
+		 Resource managers cannot be moved, since their pending asynchronous
+		 requests refer to them.
 
 		 @param[in]		manager
 						A reference to the resource manager to move.
 		 */
-		ResourceManager(ResourceManager&& manager) noexcept;
+		ResourceManager(ResourceManager&& manager) = delete;
 
 		/**
 		 Destructs this resource manager.
@@ -406,6 +419,69 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc,
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Creates a model descriptor (if not existing) asynchronously on a
+		 decode thread. No placeholder is provided for model descriptors.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the mesh descriptor.
+		 @param[in]		export_as_MDL
+						@c true if the model descriptor needs to be exported as
+						MDL file. @c false otherwise.
+		 @return		The future of the model descriptor.
+		 */
+		template< typename ResourceT, typename VertexT, typename IndexT >
+		typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+			future_type< ResourceT > >
+			GetOrCreateAsync(const std::wstring& fname,
+							 const MeshDescriptor< VertexT, IndexT >&
+							 desc = MeshDescriptor< VertexT, IndexT >(),
+							 bool export_as_MDL = false);
+
+		/**
+		 Creates a sprite font (if not existing) asynchronously on a decode
+		 thread. No placeholder is provided for sprite fonts.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the sprite font descriptor.
+		 @return		The future of the sprite font.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< SpriteFont, ResourceT >,
+			future_type< ResourceT > >
+			GetOrCreateAsync(const std::wstring& fname,
+							 const SpriteFontDescriptor& desc
+							     = SpriteFontDescriptor());
+
+		/**
+		 Creates a texture (if not existing) asynchronously. The file is read
+		 on the I/O thread and the texture is created on a decode thread. A
+		 white texture is provided as placeholder.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		The future of the texture.
+		 @throws		Exception
+						Failed to create the placeholder texture.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+			future_type< ResourceT > > GetOrCreateAsync(const std::wstring& fname);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -438,6 +514,36 @@ namespace mage::rendering {
 		[[nodiscard]]
 		const typename pool_type< ResourceT >& GetPool() const noexcept;
 
+		/**
+		 Creates a resource asynchronously on a decode thread.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		FunctionT
+						The function type.
+		 @param[in]		create
+						The function creating the resource.
+		 @param[in]		placeholder
+						A pointer to the placeholder resource.
+		 @return		The future of the resource.
+		 */
+		template< typename ResourceT, typename FunctionT >
+		future_type< ResourceT > Decode(FunctionT create,
+										SharedPtr< value_type< ResourceT > >
+										placeholder = nullptr);
+
+		/**
+		 Creates a texture asynchronously. The file is read on the I/O thread
+		 and the texture is created on a decode thread.
+
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		The future of the texture.
+		 @throws		Exception
+						Failed to create the placeholder texture.
+		 */
+		future_type< Texture > StreamTexture(const std::wstring& fname);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -491,6 +597,13 @@ namespace mage::rendering {
 		 The texture resource pool of this resource manager.
 		 */
 		typename pool_type< Texture > m_texture_pool;
+
+		/**
+		 The resource streamer of this resource manager. The resource
+		 streamer is destructed first, since its tasks refer to the resource
+		 pools of this resource manager.
+		 */
+		ResourceStreamer m_streamer;
 	};
 }
 
@@ -232,5 +232,71 @@ namespace mage::rendering {
 												  desc, initial_data);
 	}
 
+	template< typename ResourceT, typename VertexT, typename IndexT >
+	inline typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+		ResourceManager::future_type< ResourceT > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const MeshDescriptor< VertexT, IndexT >& desc,
+										  bool export_as_MDL) {
+
+		if (auto resource = Get< ResourceT >(fname)) {
+			return future_type< ResourceT >(std::move(resource));
+		}
+
+		return Decode< ResourceT >([this, fname, desc, export_as_MDL]() {
+			return GetOrCreate< ResourceT >(fname, desc, export_as_MDL);
+		});
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< SpriteFont, ResourceT >,
+		ResourceManager::future_type< ResourceT > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const SpriteFontDescriptor& desc) {
+
+		if (auto resource = Get< ResourceT >(fname)) {
+			return future_type< ResourceT >(std::move(resource));
+		}
+
+		return Decode< ResourceT >([this, fname, desc]() {
+			return GetOrCreate< ResourceT >(fname, desc);
+		});
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+		ResourceManager::future_type< ResourceT > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname) {
+
+		if (auto resource = Get< ResourceT >(fname)) {
+			return future_type< ResourceT >(std::move(resource));
+		}
+
+		return StreamTexture(fname);
+	}
+
+	template< typename ResourceT, typename FunctionT >
+	inline ResourceManager::future_type< ResourceT >
+		ResourceManager::Decode(FunctionT create,
+								SharedPtr< value_type< ResourceT > > placeholder) {
+
+		using ResourcePtr = SharedPtr< value_type< ResourceT > >;
+
+		auto promise = MakeShared< std::promise< ResourcePtr > >();
+		future_type< ResourceT > future(promise->get_future().share(),
+										std::move(placeholder));
+
+		m_streamer.Decode([promise, create(std::move(create))]() noexcept {
+			try {
+				promise->set_value(create());
+			}
+			catch (...) {
+				promise->set_exception(std::current_exception());
+			}
+		});
+
+		return future;
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -15,6 +15,96 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	//-------------------------------------------------------------------------
+	// Shader Permutations
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 The number of BRDFs.
+	 */
+	constexpr std::size_t g_nb_brdfs
+		= static_cast< std::size_t >(BRDF::Frostbite) + 1u;
+
+	/**
+	 The number of false colors.
+	 */
+	constexpr std::size_t g_nb_false_colors
+		= static_cast< std::size_t >(FalseColor::UV) + 1u;
+
+	/**
+	 The number of forward shader permutations.
+	 */
+	constexpr std::size_t g_nb_forward_permutations = g_nb_brdfs << 3u;
+
+	/**
+	 The number of deferred shader permutations.
+	 */
+	constexpr std::size_t g_nb_deferred_permutations = g_nb_brdfs << 1u;
+
+	/**
+	 Returns the permutation mask for the given shader configuration
+	 parameters.
+
+	 @param[in]		transparency
+					@c true if transparency should be enabled. @c false
+					otherwise.
+	 @param[in]		vct
+					@c true if voxel cone tracing should be enabled. @c false
+					otherwise.
+	 @param[in]		tsnm
+					@c true if tangent space normal mapping should be enabled.
+					@c false otherwise.
+	 @return		The permutation mask for the given shader configuration
+					parameters.
+	 */
+	[[nodiscard]]
+	constexpr U32 GetPermutationMask(bool transparency,
+									 bool vct,
+									 bool tsnm) noexcept;
+
+	/**
+	 Returns the index of the forward shader permutation matching the given
+	 BRDF and shader configuration parameters.
+
+	 @param[in]		brdf
+					The BRDF function.
+	 @param[in]		transparency
+					@c true if transparency should be enabled. @c false
+					otherwise.
+	 @param[in]		vct
+					@c true if voxel cone tracing should be enabled. @c false
+					otherwise.
+	 @param[in]		tsnm
+					@c true if tangent space normal mapping should be enabled.
+					@c false otherwise.
+	 @return		The index of the forward shader permutation, which is
+					smaller than @c g_nb_forward_permutations.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetForwardPermutationIndex(BRDF brdf,
+													 bool transparency,
+													 bool vct,
+													 bool tsnm) noexcept;
+
+	/**
+	 Returns the index of the deferred shader permutation matching the given
+	 BRDF and shader configuration parameters.
+
+	 @param[in]		brdf
+					The BRDF function.
+	 @param[in]		vct
+					@c true if voxel cone tracing should be enabled. @c false
+					otherwise.
+	 @return		The index of the deferred shader permutation, which is
+					smaller than @c g_nb_deferred_permutations.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetDeferredPermutationIndex(BRDF brdf,
+													  bool vct) noexcept;
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Factory Methods: General
 	//-------------------------------------------------------------------------
@@ -413,6 +503,24 @@ namespace mage::rendering {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Factory Methods: Lighting
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Creates a light clustering compute shader.
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the light clustering compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateLightClusteringCS(ResourceManager& resource_manager);
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Factory Methods: Post-processing
 	//-------------------------------------------------------------------------
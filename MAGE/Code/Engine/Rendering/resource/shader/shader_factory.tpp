@@ -5,6 +5,34 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	[[nodiscard]]
+	constexpr U32 GetPermutationMask(bool transparency,
+									 bool vct,
+									 bool tsnm) noexcept {
+
+		return static_cast< U32 >(transparency) << 2u
+			 | static_cast< U32 >(vct)          << 1u
+			 | static_cast< U32 >(tsnm);
+	}
+
+	[[nodiscard]]
+	constexpr std::size_t GetForwardPermutationIndex(BRDF brdf,
+													 bool transparency,
+													 bool vct,
+													 bool tsnm) noexcept {
+
+		return static_cast< std::size_t >(brdf) << 3u
+			 | GetPermutationMask(transparency, vct, tsnm);
+	}
+
+	[[nodiscard]]
+	constexpr std::size_t GetDeferredPermutationIndex(BRDF brdf,
+													  bool vct) noexcept {
+
+		return static_cast< std::size_t >(brdf) << 1u
+			 | static_cast< std::size_t >(vct);
+	}
+
 	template< typename... ConstructorArgsT >
 	[[nodiscard]]
 	inline VertexShaderPtr CreateVS(ResourceManager& resource_manager,
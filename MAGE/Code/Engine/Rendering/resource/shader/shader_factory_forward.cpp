@@ -84,31 +84,6 @@ namespace mage::rendering {
 
 	namespace {
 
-		/**
-		 Returns the permutation mask for the given shader configuration
-		 parameters.
-
-		 @param[in]		transparency
-						@c true if transparency should be enabled. @c false
-						otherwise.
-		 @param[in]		vct
-						@c true if voxel cone tracing should be enabled. @c
-						false otherwise.
-		 @param[in]		tsnm
-						@c true if tangent space normal mapping should be
-						enabled. @c false otherwise.
-		 @return		The permutation mask for the given shader configuration
-						parameters.
-		 */
-		inline U32 GetPermutationMask(bool transparency,
-									  bool vct,
-									  bool tsnm) noexcept {
-
-			return static_cast< U32 >(transparency) << 2u
-				 | static_cast< U32 >(vct)          << 1u
-				 | static_cast< U32 >(tsnm);
-		}
-
 		/**
 		 Creates a forward pixel shader with a Blinn-Phong BRDF.
 
@@ -0,0 +1,40 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\shader\shader_factory.hpp"
+
+// Light Clustering
+#include "lighting\light_clustering_CS.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_SHADER_GUID(buffer) L#buffer
+#define MAGE_SHADER_ARGS(buffer) MAGE_SHADER_GUID(buffer), \
+								 BufferCompiledShader(buffer)
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Factory Methods: Light Clustering
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ComputeShaderPtr CreateLightClusteringCS(ResourceManager& resource_manager) {
+		return CreateCS(resource_manager,
+						MAGE_SHADER_ARGS(g_light_clustering_CS));
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\shader\shader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of shader permutation tables.
+
+	 A shader permutation table caches the shaders of a fixed number of
+	 permutations, indexed by their permutation index. Each shader is created
+	 on first use, after which selecting it no longer involves a lookup in
+	 the resource manager.
+
+	 @tparam		ShaderT
+					The shader type.
+	 @tparam		N
+					The number of permutations.
+	 */
+	template< typename ShaderT, std::size_t N >
+	class ShaderPermutationTable {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The shader pointer type of shader permutation tables.
+		 */
+		using shader_ptr = SharedPtr< const ShaderT >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty shader permutation table.
+		 */
+		ShaderPermutationTable() noexcept = default;
+
+		/**
+		 Constructs a shader permutation table from the given shader
+		 permutation table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to copy.
+		 */
+		ShaderPermutationTable(const ShaderPermutationTable& table) noexcept = default;
+
+		/**
+		 Constructs a shader permutation table by moving the given shader
+		 permutation table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to move.
+		 */
+		ShaderPermutationTable(ShaderPermutationTable&& table) noexcept = default;
+
+		/**
+		 Destructs this shader permutation table.
+		 */
+		~ShaderPermutationTable() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to copy.
+		 @return		A reference to the copy of the given shader permutation
+						table (i.e. this shader permutation table).
+		 */
+		ShaderPermutationTable& operator=(const ShaderPermutationTable& table) noexcept = default;
+
+		/**
+		 Moves the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to move.
+		 @return		A reference to the moved shader permutation table (i.e.
+						this shader permutation table).
+		 */
+		ShaderPermutationTable& operator=(ShaderPermutationTable&& table) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shader of the given permutation of this shader
+		 permutation table, and creates it first if not yet cached.
+
+		 @pre			@a index is smaller than @a N.
+		 @tparam		FactoryT
+						The factory type.
+		 @param[in]		index
+						The permutation index.
+		 @param[in]		create
+						The factory creating the shader of the given
+						permutation.
+		 @return		A reference to the shader of the given permutation.
+		 @throws		Exception
+						Failed to create the shader.
+		 */
+		template< typename FactoryT >
+		[[nodiscard]]
+		const ShaderT& GetOrCreate(std::size_t index, FactoryT&& create) {
+			auto& shader = m_shaders[index];
+			if (!shader) {
+				shader = create();
+			}
+
+			return *shader;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 An array containing the cached shaders of this shader permutation
+		 table.
+		 */
+		std::array< shader_ptr, N > m_shaders;
+	};
+}
@@ -57,6 +57,15 @@ namespace mage::rendering {
 			NotNull< ID3D11ShaderResourceView** >(m_texture_srv.ReleaseAndGetAddressOf()));
 	}
 
+	Texture::Texture(ID3D11Device& device, std::wstring fname,
+					 gsl::span< const U8 > data)
+		: Resource< Texture >(std::move(fname)),
+		m_texture_srv() {
+
+		loader::ImportTextureFromMemory(GetPath(), data, device,
+			NotNull< ID3D11ShaderResourceView** >(m_texture_srv.ReleaseAndGetAddressOf()));
+	}
+
 	Texture::Texture(ID3D11Device& device, std::wstring guid,
 					 const D3D11_TEXTURE2D_DESC& desc,
 					 const D3D11_SUBRESOURCE_DATA& initial_data)
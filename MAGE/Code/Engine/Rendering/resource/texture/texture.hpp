@@ -73,6 +73,21 @@ namespace mage::rendering {
 		 */
 		explicit Texture(ID3D11Device& device, std::wstring fname);
 
+		/**
+		 Constructs a texture from the given file data.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		data
+						The data of the file associated with @a fname.
+		 @throws		Exception
+						Failed to construct the texture.
+		 */
+		explicit Texture(ID3D11Device& device, std::wstring fname,
+						 gsl::span< const U8 > data);
+
 		/**
 		 Constructs a 2D texture.
 
@@ -54,8 +54,8 @@ namespace mage::rendering {
 
 	Camera& Camera::operator=(Camera&& camera) noexcept = default;
 
-	void Camera::UpdateBuffer(ID3D11DeviceContext& device_context,
-							  AntiAliasing aa) const {
+	[[nodiscard]]
+	const CameraBuffer Camera::GetBufferData(AntiAliasing aa) const noexcept {
 		Assert(HasOwner());
 
 		CameraBuffer buffer;
@@ -115,6 +115,11 @@ namespace mage::rendering {
 			buffer.m_focus_distance  = m_lens.GetFocusDistance();
 		}
 
+		return buffer;
+	}
+
+	void Camera::UpdateBuffer(ID3D11DeviceContext& device_context,
+							  const CameraBuffer& buffer) const {
 		// Update the camera buffer.
 		m_buffer.UpdateData(device_context, buffer);
 	}
@@ -737,6 +737,7 @@ namespace mage::rendering {
 			: m_render_mode(RenderMode::Forward),
 			m_brdf(BRDF::Frostbite),
 			m_tone_mapping(ToneMapping::ACESFilmic),
+			m_gpu_light_clustering(true),
 			m_render_layer_mask(static_cast< U32 >(RenderLayer::None)),
 			m_fog(),
 			m_sky() {}
@@ -839,6 +840,31 @@ namespace mage::rendering {
 			return m_voxelization_settings;
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Light Clustering
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool UsesGPULightClustering() const noexcept {
+			return m_gpu_light_clustering;
+		}
+
+		void EnableGPULightClustering() noexcept {
+			SetGPULightClustering(true);
+		}
+
+		void DisableGPULightClustering() noexcept {
+			SetGPULightClustering(false);
+		}
+
+		void ToggleGPULightClustering() noexcept {
+			SetGPULightClustering(!UsesGPULightClustering());
+		}
+
+		void SetGPULightClustering(bool gpu_light_clustering = true) noexcept {
+			m_gpu_light_clustering = gpu_light_clustering;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Render Layers
 		//---------------------------------------------------------------------
@@ -945,6 +971,17 @@ namespace mage::rendering {
 		 */
 		VoxelizationSettings m_voxelization_settings;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Light Clustering
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether the lights are assigned to the light
+		 clusters on the GPU (compute shader) or on the CPU (job system) for
+		 this camera settings.
+		 */
+		bool m_gpu_light_clustering;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Layers
 		//---------------------------------------------------------------------
@@ -1139,16 +1176,27 @@ namespace mage::rendering {
 		// Member Methods: Buffer
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the buffer data of this camera.
+
+		 @pre			This camera must have an owner.
+		 @param[in]		aa
+						The anti-aliasing mode.
+		 @return		The buffer data of this camera.
+		 */
+		[[nodiscard]]
+		const CameraBuffer GetBufferData(AntiAliasing aa) const noexcept;
+
 		/**
 		 Updates the buffer of this camera.
 
 		 @param[in,out]	device_context
 						A reference to the device context.
-		 @param[in]		aa
-						The anti-aliasing mode.
+		 @param[in]		buffer
+						A reference to the buffer data.
 		 */
 		void UpdateBuffer(ID3D11DeviceContext& device_context,
-						  AntiAliasing aa) const;
+						  const CameraBuffer& buffer) const;
 
 		/**
 		 Binds the buffer of this camera to the given pipeline stage.
@@ -13,9 +13,14 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	Model::Model(ID3D11Device& device)
+	Model::Model() noexcept
 		: Component(),
-		m_buffer(device),
+		m_buffer_data(),
+		m_buffers(nullptr),
+		m_buffer_range(),
+		m_buffer(),
+		m_buffer_transform_version(0u),
+		m_dirty_buffer(true),
 		m_aabb(),
 		m_sphere(),
 		m_mesh(),
@@ -44,27 +49,59 @@ namespace mage::rendering {
 		m_nb_indices  = nb_indices;
 	}
 
-	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
+	[[nodiscard]]
+	bool Model::HasDirtyBuffer() const noexcept {
 		Assert(HasOwner());
 
-		const auto& transform         = GetOwner()->GetTransform();
-		const auto  object_to_world   = transform.GetObjectToWorldMatrix();
-		const auto  world_to_object   = transform.GetWorldToObjectMatrix();
-		const auto  texture_transform = m_texture_transform.GetTransformMatrix();
-
-		ModelBuffer buffer;
-		// Transforms
-		buffer.m_object_to_world      = XMMatrixTranspose(object_to_world);
-		buffer.m_normal_to_world      = world_to_object;
-		buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
-		// Material
-		buffer.m_base_color           = m_material.IsEmissive()
-			                          ? m_material.GetRadianceSpectrum()
-			                          : m_material.GetBaseColor();
-		buffer.m_roughness            = m_material.GetRoughness();
-		buffer.m_metalness            = m_material.GetMetalness();
-
-		// Update the model buffer.
-		m_buffer.UpdateData(device_context, buffer);
+		return m_dirty_buffer
+			|| GetOwner()->GetTransform().GetVersion() != m_buffer_transform_version;
+	}
+
+	[[nodiscard]]
+	const ModelBuffer& Model::GetBufferData() const noexcept {
+		if (HasDirtyBuffer()) {
+			const auto& transform         = GetOwner()->GetTransform();
+			const auto  object_to_world   = transform.GetObjectToWorldMatrix();
+			const auto  world_to_object   = transform.GetWorldToObjectMatrix();
+			const auto  texture_transform = m_texture_transform.GetTransformMatrix();
+
+			auto& buffer = m_buffer_data;
+			// Transforms
+			buffer.m_object_to_world      = XMMatrixTranspose(object_to_world);
+			buffer.m_normal_to_world      = world_to_object;
+			buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
+			// Material
+			buffer.m_base_color           = m_material.IsEmissive()
+				                          ? m_material.GetRadianceSpectrum()
+				                          : m_material.GetBaseColor();
+			buffer.m_roughness            = m_material.GetRoughness();
+			buffer.m_metalness            = m_material.GetMetalness();
+
+			m_buffer_transform_version = transform.GetVersion();
+			m_dirty_buffer             = false;
+		}
+
+		return m_buffer_data;
+	}
+
+	void Model::UpdateBuffer(ConstantBufferRing< ModelBuffer >& buffers,
+							 const ModelBuffer& buffer) const {
+		m_buffers = &buffers;
+
+		if (buffers.SupportsOffsetting()) {
+			// Write the model buffer to the ring.
+			m_buffer_range = buffers.Allocate(buffer);
+			return;
+		}
+
+		auto& device_context = buffers.GetDeviceContext();
+		if (!m_buffer) {
+			ComPtr< ID3D11Device > device;
+			device_context.GetDevice(device.ReleaseAndGetAddressOf());
+			m_buffer = MakeUnique< ConstantBuffer< ModelBuffer > >(*device.Get());
+		}
+
+		// Write the model buffer to the constant buffer of this model.
+		m_buffer->UpdateData(device_context, buffer);
 	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "geometry\bounding_volume.hpp"
 #include "transform\transform.hpp"
 #include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\constant_buffer_ring.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
 
 #pragma endregion
@@ -36,11 +37,8 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a model.
-
-		 @param[in,out]	device
-						A reference to the device.
 		 */
-		explicit Model(ID3D11Device& device);
+		Model() noexcept;
 
 		/**
 		 Constructs a model from the given model.
@@ -151,6 +149,16 @@ namespace mage::rendering {
 			return m_nb_indices;
 		}
 
+		/**
+		 Returns the mesh of this model.
+
+		 @return		A pointer to the mesh of this model.
+		 */
+		[[nodiscard]]
+		const Mesh* GetMesh() const noexcept {
+			return m_mesh.get();
+		}
+
 		/**
 		 Binds the mesh of this model.
 
@@ -192,10 +200,14 @@ namespace mage::rendering {
 		/**
 		 Returns the texture transform of this model.
 
+		 The buffer of this model is marked dirty, since the texture transform can be
+		 modified through the returned reference.
+
 		 @return		A reference to the texture transform of this model.
 		 */
 		[[nodiscard]]
 		TextureTransform2D& GetTextureTransform() noexcept {
+			m_dirty_buffer = true;
 			return m_texture_transform;
 		}
 
@@ -212,10 +224,14 @@ namespace mage::rendering {
 		/**
 		 Returns the material of this model.
 
+		 The buffer of this model is marked dirty, since the material can be
+		 modified through the returned reference.
+
 		 @return		A reference to the material of this model.
 		 */
 		[[nodiscard]]
 		Material& GetMaterial() noexcept {
+			m_dirty_buffer = true;
 			return m_material;
 		}
 
@@ -280,31 +296,74 @@ namespace mage::rendering {
 		// Member Methods: Buffer
 		//---------------------------------------------------------------------
 
+		/**
+		 Checks whether the buffer of this model is out of date.
+
+		 The buffer of this model is out of date if the transform of its owner,
+		 its texture transform or its material changed since the last update.
+
+		 @pre			This model must have an owner.
+		 @return		@c true if the buffer of this model is out of date.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasDirtyBuffer() const noexcept;
+
+		/**
+		 Returns the buffer data of this model.
+
+		 The buffer data is only recomputed if the buffer of this model is out
+		 of date.
+
+		 @pre			This model must have an owner.
+		 @return		A reference to the buffer data of this model.
+		 */
+		[[nodiscard]]
+		const ModelBuffer& GetBufferData() const noexcept;
+
 		/**
 		 Updates the buffer of this model.
 
-		 @param[in,out]	device_context
-						A reference to the device context.
+		 The given buffer data is written to the given constant buffer ring
+		 each frame. If the constant buffer ring does not support constant
+		 buffer offsetting, the given buffer data is written to a constant
+		 buffer of this model instead.
+
+		 @pre			@a buffers is mapped.
+		 @param[in,out]	buffers
+						A reference to the constant buffer ring of the model
+						buffers of the current frame.
+		 @param[in]		buffer
+						A reference to the buffer data (obtained with
+						{@link mage::rendering::Model::GetBufferData()}).
+		 @throws		Exception
+						Failed to create the constant buffer of this model.
 		 */
-		void UpdateBuffer(ID3D11DeviceContext& device_context) const;
+		void UpdateBuffer(ConstantBufferRing< ModelBuffer >& buffers,
+						  const ModelBuffer& buffer) const;
 
 		/**
 		 Binds the buffer of this model to the given pipeline stage.
 
+		 @pre			The buffer of this model is updated during the current
+						frame.
 		 @tparam		PipelineStageT
 						The pipeline stage type.
-		 @param[in,out]	device_context
-						A reference to the device context.
 		 @param[in]		slot
 						The index into the device's zero-based array to set
 						the constant buffer to (ranges from 0 to
 						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
 		 */
 		template< typename PipelineStageT >
-		void BindBuffer(ID3D11DeviceContext& device_context,
-						U32 slot) const noexcept {
-
-			m_buffer.Bind< PipelineStageT >(device_context, slot);
+		void BindBuffer(U32 slot) const noexcept {
+			Assert(m_buffers);
+			if (m_buffer) {
+				m_buffer->Bind< PipelineStageT >(m_buffers->GetDeviceContext(),
+												 slot);
+			}
+			else {
+				m_buffers->Bind< PipelineStageT >(slot, m_buffer_range);
+			}
 		}
 
 	private:
@@ -314,9 +373,39 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 The buffer of this model.
+		 The buffer data of this model.
+		 */
+		mutable ModelBuffer m_buffer_data;
+
+		/**
+		 A pointer to the constant buffer ring containing the buffer of this
+		 model.
+		 */
+		mutable const ConstantBufferRing< ModelBuffer >* m_buffers;
+
+		/**
+		 The range of the buffer of this model in the constant buffer ring.
+		 */
+		mutable ConstantBufferRange m_buffer_range;
+
+		/**
+		 A pointer to the buffer of this model, if the constant buffer ring
+		 does not support constant buffer offsetting.
+		 */
+		mutable UniquePtr< ConstantBuffer< ModelBuffer > > m_buffer;
+
+		/**
+		 The version of the transform of the owner of this model at the last
+		 update of the buffer data of this model.
+		 */
+		mutable U64 m_buffer_transform_version;
+
+		/**
+		 A flag indicating whether the texture transform or material of this
+		 model changed since the last update of the buffer data of this
+		 model.
 		 */
-		mutable ConstantBuffer< ModelBuffer > m_buffer;
+		mutable bool m_dirty_buffer;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Geometry
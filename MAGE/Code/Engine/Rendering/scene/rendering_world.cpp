@@ -7,6 +7,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -34,6 +43,18 @@ namespace mage::rendering {
 
 	World& World::operator=(World&& world) noexcept = default;
 
+	void World::Compact() {
+		m_perspective_cameras.compact();
+		m_orthographic_cameras.compact();
+		m_ambient_lights.compact();
+		m_directional_lights.compact();
+		m_omni_lights.compact();
+		m_spot_lights.compact();
+		m_models.compact();
+		m_sprite_images.compact();
+		m_sprite_texts.compact();
+	}
+
 	void World::Clear() noexcept {
 		m_perspective_cameras.clear();
 		m_orthographic_cameras.clear();
@@ -45,4 +66,18 @@ namespace mage::rendering {
 		m_sprite_images.clear();
 		m_sprite_texts.clear();
 	}
+
+	[[nodiscard]]
+	U64 World::GetVersion() const noexcept {
+		// The versions of the element vectors are unique and only increase.
+		return std::max({ m_perspective_cameras.version(),
+						  m_orthographic_cameras.version(),
+						  m_ambient_lights.version(),
+						  m_directional_lights.version(),
+						  m_omni_lights.version(),
+						  m_spot_lights.version(),
+						  m_models.version(),
+						  m_sprite_images.version(),
+						  m_sprite_texts.version() });
+	}
 }
\ No newline at end of file
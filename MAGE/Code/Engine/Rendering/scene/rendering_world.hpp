@@ -7,6 +7,7 @@
 
 #include "display\display_configuration.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "scene\element_vector.hpp"
 #include "scene\node.hpp"
 #include "scene\camera\orthographic_camera.hpp"
 #include "scene\camera\perspective_camera.hpp"
@@ -111,11 +112,28 @@ namespace mage::rendering {
 		template< typename ComponentT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		/**
+		 Removes the terminated components of this world. Proxy pointers to
+		 the remaining components remain valid.
+		 */
+		void Compact();
+
 		/**
 		 Clears this world.
 		 */
 		void Clear() noexcept;
 
+		/**
+		 Returns the version of this world. The version changes whenever
+		 this world moves, destroys or replaces its components (i.e. whenever
+		 pointers to its components may become invalid). Versions are unique
+		 across all worlds.
+
+		 @return		The version of this world.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -144,47 +162,47 @@ namespace mage::rendering {
 		/**
 		 A vector containing the perspective cameras of this world.
 		 */
-		AlignedVector< PerspectiveCamera > m_perspective_cameras;
+		ElementVector< PerspectiveCamera > m_perspective_cameras;
 
 		/**
 		 A vector containing the orthographic cameras of this world.
 		 */
-		AlignedVector< OrthographicCamera > m_orthographic_cameras;
+		ElementVector< OrthographicCamera > m_orthographic_cameras;
 
 		/**
 		 A vector containing the ambient lights of this world.
 		 */
-		AlignedVector< AmbientLight > m_ambient_lights;
+		ElementVector< AmbientLight > m_ambient_lights;
 
 		/**
 		 A vector containing the directional lights of this world.
 		 */
-		AlignedVector< DirectionalLight > m_directional_lights;
+		ElementVector< DirectionalLight > m_directional_lights;
 
 		/**
 		 A vector containing the omni lights of this world.
 		 */
-		AlignedVector< OmniLight > m_omni_lights;
+		ElementVector< OmniLight > m_omni_lights;
 
 		/**
 		 A vector containing the spot lights of this world.
 		 */
-		AlignedVector< SpotLight > m_spot_lights;
+		ElementVector< SpotLight > m_spot_lights;
 
 		/**
 		 A vector containing the models of this world.
 		 */
-		AlignedVector< Model > m_models;
+		ElementVector< Model > m_models;
 
 		/**
 		 A vector containing the sprite images of this world.
 		 */
-		AlignedVector< SpriteImage > m_sprite_images;
+		ElementVector< SpriteImage > m_sprite_images;
 
 		/**
 		 A vector containing the sprite texts of this world.
 		 */
-		AlignedVector< SpriteText > m_sprite_texts;
+		ElementVector< SpriteText > m_sprite_texts;
 	};
 }
 
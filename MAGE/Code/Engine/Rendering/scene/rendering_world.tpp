@@ -68,7 +68,7 @@ namespace mage::rendering {
 
 	template<>
 	inline ProxyPtr< Model > World::Create() {
-		return AddElement(m_models, m_device);
+		return AddElement(m_models);
 	}
 
 	template<>
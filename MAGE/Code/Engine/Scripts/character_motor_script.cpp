@@ -82,4 +82,12 @@ namespace mage::script {
 			transform.AddTranslationY( movement_magnitude);
 		}
 	}
+
+	[[nodiscard]]
+	bool CharacterMotorScript::GetWrittenNodes(
+		std::vector< const Node* >& nodes) const {
+
+		nodes.push_back(GetOwner().Get());
+		return true;
+	}
 }
\ No newline at end of file
@@ -43,6 +43,10 @@ namespace mage::script {
 		virtual void Load([[maybe_unused]] Engine& engine) override;
 		virtual void Update([[maybe_unused]] Engine& engine) override;
 
+		[[nodiscard]]
+		virtual bool GetWrittenNodes(
+			std::vector< const Node* >& nodes) const override;
+
 		[[nodiscard]]
 		F32 GetVelocity() const noexcept {
 			return m_velocity;
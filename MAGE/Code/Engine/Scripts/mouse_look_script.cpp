@@ -86,4 +86,12 @@ namespace mage::script {
 		}
 		}
 	}
+
+	[[nodiscard]]
+	bool MouseLookScript::GetWrittenNodes(
+		std::vector< const Node* >& nodes) const {
+
+		nodes.push_back(GetOwner().Get());
+		return true;
+	}
 }
\ No newline at end of file
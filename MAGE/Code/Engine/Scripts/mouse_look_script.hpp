@@ -48,6 +48,10 @@ namespace mage::script {
 		virtual void Load([[maybe_unused]] Engine& engine) override;
 		virtual void Update([[maybe_unused]] Engine& engine) override;
 
+		[[nodiscard]]
+		virtual bool GetWrittenNodes(
+			std::vector< const Node* >& nodes) const override;
+
 		[[nodiscard]]
 		RotationAxes GetRotationAxes() const noexcept {
 			return m_axes;
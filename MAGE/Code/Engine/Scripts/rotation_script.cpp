@@ -58,4 +58,12 @@ namespace mage::script {
 		}
 		}
 	}
+
+	[[nodiscard]]
+	bool RotationScript::GetWrittenNodes(
+		std::vector< const Node* >& nodes) const {
+
+		nodes.push_back(GetOwner().Get());
+		return true;
+	}
 }
\ No newline at end of file
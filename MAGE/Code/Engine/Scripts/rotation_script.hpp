@@ -47,6 +47,10 @@ namespace mage::script {
 		virtual void Load([[maybe_unused]] Engine& engine) override;
 		virtual void Update([[maybe_unused]] Engine& engine) override;
 
+		[[nodiscard]]
+		virtual bool GetWrittenNodes(
+			std::vector< const Node* >& nodes) const override;
+
 		[[nodiscard]]
 		RotationAxis GetRotationAxis() const noexcept {
 			return m_axis;
@@ -71,7 +71,10 @@ namespace mage::script {
 
 		m_text->SetText(L"FPS: ");
 		m_text->AppendText({ std::to_wstring(m_fps), color });
-		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}",
-								  m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws));
+		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}\nBinds: {} ({} elided)",
+								  m_spf, m_cpu, m_ram,
+								  rendering::Pipeline::s_nb_draws,
+								  rendering::Pipeline::s_nb_binds,
+								  rendering::Pipeline::s_nb_elided_binds));
 	}
 }
\ No newline at end of file
@@ -32,7 +32,7 @@ namespace mage::script {
 		const auto& keyboard = engine.GetInputManager().GetKeyboard();
 
 		if (keyboard.IsActivated(DIK_F3)) {
-			engine.RequestScene(MakeUnique< SceneT >());
+			engine.PreloadScene(MakeUnique< SceneT >());
 		}
 	}
 }
\ No newline at end of file
@@ -33,6 +33,23 @@
 #define GROUP_SIZE_2D_DEFAULT   16  // 16^2 = 256, 256/64 = 4
 #define GROUP_SIZE_3D_DEFAULT    8  //  8^3 = 512, 512/64 = 8
 
+//-----------------------------------------------------------------------------
+// Engine Includes: Light Clusters
+//-----------------------------------------------------------------------------
+
+#define LIGHT_CLUSTER_GRID_X                      16
+#define LIGHT_CLUSTER_GRID_Y                       8
+#define LIGHT_CLUSTER_GRID_Z                      24
+#define LIGHT_CLUSTER_COUNT                     3072 // 16 * 8 * 24
+#define LIGHT_CLUSTER_MAX_LIGHTS                 256
+#define LIGHT_CLUSTER_GROUP_SIZE                  64
+
+//-----------------------------------------------------------------------------
+// Engine Includes: Shadow Cascades
+//-----------------------------------------------------------------------------
+
+#define SHADOW_CASCADE_COUNT                       4
+
 //-----------------------------------------------------------------------------
 // Engine Includes: Samplers
 //-----------------------------------------------------------------------------
@@ -80,6 +97,8 @@
 #define SLOT_SRV_DIRECTIONAL_SHADOW_MAPS           7
 #define SLOT_SRV_OMNI_SHADOW_MAPS                  8
 #define SLOT_SRV_SPOT_SHADOW_MAPS                  9
+// Light Clusters
+#define SLOT_SRV_LIGHT_CLUSTERS                   16
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Voxelization
@@ -115,4 +134,7 @@
 #define SLOT_UAV_VOXEL_BUFFER                      0
 #define SLOT_UAV_VOXEL_TEXTURE                     1
 
+#define SLOT_UAV_LIGHT_CLUSTERS                    0
+#define SLOT_UAV_LIGHT_INDEX_LIST                  1
+
 #endif // MAGE_HEADER_HLSL
\ No newline at end of file
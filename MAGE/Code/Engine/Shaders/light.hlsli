@@ -55,6 +55,65 @@ struct ShadowMap {
 	}
 };
 
+/**
+ A struct of shadow atlas maps.
+ */
+struct ShadowAtlasMap {
+
+	//-------------------------------------------------------------------------
+	// Member Variables
+	//-------------------------------------------------------------------------
+
+	/**
+	 The PCF sampler comparison state of this shadow atlas map.
+	 */
+	SamplerComparisonState m_pcf_sampler;
+
+	/**
+	 The array of shadow map textures containing the shadow atlas texture of
+	 this shadow atlas map (at index 0).
+	 */
+	Texture2DArray< float > m_maps;
+
+	/**
+	 The tile of this shadow atlas map [offset.u, offset.v, scale, unused]
+	 expressed in UV space of the shadow atlas texture. A zero scale indicates
+	 that no tile is allocated.
+	 */
+	float4 m_tile;
+
+	//-------------------------------------------------------------------------
+	// Member Methods
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the shadow factor of this shadow atlas map.
+
+	 @param[in]		p_ndc
+					The hit position expressed in light NDC space.
+	 @return		The shadow factor of this shadow atlas map corresponding
+					to the given hit position expressed in light NDC space.
+	 */
+	float ShadowFactor(float3 p_ndc) {
+		[branch]
+		if (0.0f == m_tile.z) {
+			return 1.0f;
+		}
+
+		float width, height, nb_elements;
+		m_maps.GetDimensions(width, height, nb_elements);
+
+		// Prevent the PCF filter from sampling neighbouring tiles.
+		const float  inset  = 0.5f / width;
+		const float2 uv     = NDCtoUV(p_ndc.xy) * m_tile.z + m_tile.xy;
+		const float2 uv_min = m_tile.xy + inset;
+		const float2 uv_max = m_tile.xy + m_tile.z - inset;
+		const float3 location = { clamp(uv, uv_min, uv_max), 0.0f };
+
+		return  m_maps.SampleCmpLevelZero(m_pcf_sampler, location, p_ndc.z);
+	}
+};
+
 /**
  A struct of shadow cube maps.
  */
@@ -253,33 +312,6 @@ struct DirectionalLight {
 		l_world = l_world0;
 		E_ortho = E_ortho0;
 	}
-
-	/**
-	 Computes the (orthogonal) irradiance contribution of this directional
-	 light.
-
-	 @param[in]		map
-					The shadow map.
-	 @param[in]		p_world
-					The hit position expressed in world space.
-	 @param[out]	l_world
-					The (normalized) light (hit-to-light) direction expressed
-					in world space.
-	 @param[out]	E_ortho
-					The (orthogonal) irradiance contribution of this
-					directional light.
-	 */
-	void Contribution(ShadowMap map, float3 p_world,
-					  out float3 l_world, out float3 E_ortho) {
-
-		float3 l_world0, E_ortho0, p_ndc;
-		Contribution(p_world, l_world0, E_ortho0, p_ndc);
-
-		l_world = l_world0;
-
-		const float shadow_factor = map.ShadowFactor(p_ndc);
-		E_ortho = shadow_factor * E_ortho0;
-	}
 };
 
 /**
@@ -404,7 +436,70 @@ struct SpotLight : PointLight {
 /**
  A struct of shadow mapped directional lights.
  */
-typedef DirectionalLight ShadowMappedDirectionalLight;
+struct ShadowMappedDirectionalLight : DirectionalLight {
+
+	//-------------------------------------------------------------------------
+	// Member Variables
+	//-------------------------------------------------------------------------
+
+	/**
+	 The world-to-projection transformation matrices of the shadow cascades
+	 of this shadow mapped directional light (ordered from near to far).
+	 */
+	float4x4 m_cascade_world_to_projections[SHADOW_CASCADE_COUNT];
+
+	//-------------------------------------------------------------------------
+	// Member Methods
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the (orthogonal) irradiance contribution of this directional
+	 light.
+
+	 @param[in]		map
+					The shadow map of the first shadow cascade. The shadow
+					maps of the other shadow cascades are stored at the
+					subsequent indices.
+	 @param[in]		p_world
+					The hit position expressed in world space.
+	 @param[out]	l_world
+					The (normalized) light (hit-to-light) direction expressed
+					in world space.
+	 @param[out]	E_ortho
+					The (orthogonal) irradiance contribution of this
+					directional light.
+	 */
+	void Contribution(ShadowMap map, float3 p_world,
+					  out float3 l_world, out float3 E_ortho) {
+
+		float3 l_world0, E_ortho0, p_ndc0;
+		DirectionalLight::Contribution(p_world, l_world0, E_ortho0, p_ndc0);
+
+		l_world = l_world0;
+
+		// Select the first (i.e. finest) shadow cascade containing the hit
+		// position. Hit positions beyond the last shadow cascade are not
+		// shadowed.
+		float shadow_factor = 1.0f;
+		[loop]
+		for (uint i = 0u; i < SHADOW_CASCADE_COUNT; ++i) {
+			const float4 p_proj = mul(float4(p_world, 1.0f),
+									  m_cascade_world_to_projections[i]);
+			const float3 p_ndc  = HomogeneousDivide(p_proj);
+
+			[branch]
+			if (all(abs(p_ndc.xy) < 1.0f)) {
+				const ShadowMap cascade_map = {
+					map.m_pcf_sampler, map.m_maps, map.m_index + i
+				};
+				shadow_factor = cascade_map.ShadowFactor(p_ndc);
+				break;
+			}
+		}
+
+		E_ortho = shadow_factor * E_ortho0;
+	}
+};
 
 /**
  A struct of shadow mapped omni lights.
@@ -476,6 +571,12 @@ struct ShadowMappedSpotLight : SpotLight {
 	 */
 	float4x4 m_world_to_projection;
 
+	/**
+	 The shadow atlas tile of this shadow mapped spotlight [offset.u,
+	 offset.v, scale, unused] expressed in UV space of the shadow atlas.
+	 */
+	float4 m_shadow_tile;
+
 	//-------------------------------------------------------------------------
 	// Member Methods
 	//-------------------------------------------------------------------------
@@ -484,7 +585,7 @@ struct ShadowMappedSpotLight : SpotLight {
 	 Computes the (orthogonal) irradiance contribution of this spotlight.
 
 	 @param[in]		map
-					The shadow map.
+					The shadow atlas map.
 	 @param[in]		p_world
 					The hit position expressed in world space.
 	 @param[out]	l_world
@@ -493,7 +594,7 @@ struct ShadowMappedSpotLight : SpotLight {
 	 @param[out]	E_ortho
 					The (orthogonal) irradiance contribution of this spotlight.
 	 */
-	void Contribution(ShadowMap map, float3 p_world,
+	void Contribution(ShadowAtlasMap map, float3 p_world,
 					  out float3 l_world, out float3 E_ortho) {
 
 		float3 l_world0, E_ortho0;
@@ -0,0 +1,142 @@
+#ifndef MAGE_HEADER_LIGHT_CLUSTER
+#define MAGE_HEADER_LIGHT_CLUSTER
+
+// The view frustum of the camera is partitioned in a grid of light clusters.
+// The grid is uniform in NDC space along the x and y axis, and exponential in
+// camera space along the z axis between the clipping planes of the camera.
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions: Constants
+//-----------------------------------------------------------------------------
+
+/**
+ The number of light clusters along each axis.
+ */
+static const uint3 g_light_cluster_grid = {
+	LIGHT_CLUSTER_GRID_X,
+	LIGHT_CLUSTER_GRID_Y,
+	LIGHT_CLUSTER_GRID_Z
+};
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+
+/**
+ Flattens the given light cluster coordinates.
+
+ @param[in]		cluster
+				The light cluster coordinates.
+ @return		The index of the light cluster.
+ */
+uint FlattenLightCluster(uint3 cluster) {
+	return cluster.x + LIGHT_CLUSTER_GRID_X
+		 * (cluster.y + LIGHT_CLUSTER_GRID_Y * cluster.z);
+}
+
+/**
+ Converts the given position expressed in camera space to the index of the
+ light cluster containing that position.
+
+ @param[in]		p_camera
+				The position expressed in camera space.
+ @param[in]		depth_scale_bias
+				The scale and bias converting the base-2 logarithm of a
+				camera space depth to a light cluster slice.
+ @return		The index of the light cluster containing the given
+				position.
+ */
+uint CameraToLightCluster(float3 p_camera, float2 depth_scale_bias) {
+	// Camera -> NDC
+	const float4 p_proj = mul(float4(p_camera, 1.0f), g_camera_to_projection);
+	const float2 p_ndc  = p_proj.xy / p_proj.w;
+	// [-1,1]^2 -> [0,1]^2
+	const float2 uv     = saturate(0.5f * p_ndc + 0.5f);
+	const float  slice  = log2(max(p_camera.z, 1e-4f)) * depth_scale_bias.x
+		                + depth_scale_bias.y;
+
+	const float3 cluster = float3(uv * g_light_cluster_grid.xy, max(slice, 0.0f));
+	return FlattenLightCluster(min(uint3(cluster), g_light_cluster_grid - 1u));
+}
+
+/**
+ Computes the planes of the given light cluster expressed in camera space.
+ The planes are normalized, inward facing and ordered as follows: left,
+ right, bottom, top, near and far.
+
+ @param[in]		cluster
+				The light cluster coordinates.
+ @param[in]		depth_scale_bias
+				The scale and bias converting the base-2 logarithm of a
+				camera space depth to a light cluster slice.
+ @param[out]	planes
+				The planes of the light cluster expressed in camera space.
+ */
+void GetLightClusterPlanes(uint3 cluster, float2 depth_scale_bias,
+						   out float4 planes[6]) {
+
+	const float4x4 c_to_p = transpose(g_camera_to_projection);
+
+	// The NDC range of the light cluster along the x and y axis.
+	const float2 ndc_min = (2.0f * cluster.xy)      / g_light_cluster_grid.xy - 1.0f;
+	const float2 ndc_max = (2.0f * cluster.xy + 2.0f) / g_light_cluster_grid.xy - 1.0f;
+
+	// The NDC range of the light cluster along the z axis.
+	const float2 z_camera = exp2((float2(cluster.z, cluster.z + 1u)
+								  - depth_scale_bias.y) / depth_scale_bias.x);
+	const float2 z_ndc    = (z_camera * c_to_p[2][2] + c_to_p[2][3])
+		                  / (z_camera * c_to_p[3][2] + c_to_p[3][3]);
+
+	// Remap the NDC range of the light cluster to the canonical view volume.
+	const float2 scale_xy = 2.0f / (ndc_max - ndc_min);
+	const float2 bias_xy  = -(ndc_min + ndc_max) / (ndc_max - ndc_min);
+	const float  scale_z  = 1.0f / (z_ndc.y - z_ndc.x);
+	const float  bias_z   = -z_ndc.x * scale_z;
+
+	const float4 x = scale_xy.x * c_to_p[0] + bias_xy.x * c_to_p[3];
+	const float4 y = scale_xy.y * c_to_p[1] + bias_xy.y * c_to_p[3];
+	const float4 z = scale_z    * c_to_p[2] + bias_z    * c_to_p[3];
+	const float4 w = c_to_p[3];
+
+	planes[0] = w + x;
+	planes[1] = w - x;
+	planes[2] = w + y;
+	planes[3] = w - y;
+	planes[4] = z;
+	planes[5] = w - z;
+
+	[unroll]
+	for (uint i = 0u; i < 6u; ++i) {
+		planes[i] /= length(planes[i].xyz);
+	}
+}
+
+/**
+ Checks whether the given sphere overlaps the given light cluster.
+
+ @param[in]		planes
+				The planes of the light cluster.
+ @param[in]		p
+				The center of the sphere.
+ @param[in]		r
+				The radius of the sphere.
+ @return		@c true if the given sphere overlaps the given light
+				cluster. @c false otherwise.
+ */
+bool Overlaps(float4 planes[6], float3 p, float r) {
+	[unroll]
+	for (uint i = 0u; i < 6u; ++i) {
+		if (dot(planes[i].xyz, p) + planes[i].w < -r) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#endif // MAGE_HEADER_LIGHT_CLUSTER
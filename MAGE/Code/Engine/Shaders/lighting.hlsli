@@ -17,6 +17,7 @@
 // DISABLE_BRDF_DIFFUSE                     | not defined
 // DISABLE_BRDF_SPECULAR                    | not defined
 // DISABLE_FOG                              | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // DISABLE_LIGHTS_AMBIENT                   | not defined
 // DISABLE_LIGHTS_DIRECTIONAL               | not defined
 // DISABLE_LIGHTS_OMNI                      | not defined
@@ -26,6 +27,7 @@
 // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI        | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT        | not defined
 // DISABLE_VCT                              | not defined
+// LIGHT_CLUSTERING                         | not defined
 
 //-----------------------------------------------------------------------------
 // Engine Includes
@@ -34,8 +36,12 @@
 #include "brdf.hlsli"
 #include "material.hlsli"
 
-#ifdef BRDF_FUNCTION
+#if defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
 	#include "light.hlsli"
+	#include "light_cluster.hlsli"
+#endif // defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
+
+#ifdef BRDF_FUNCTION
 
 	#ifndef DISABLE_VCT
 		#include "vct.hlsli"
@@ -46,7 +52,7 @@
 //-----------------------------------------------------------------------------
 // Constant Buffers
 //-----------------------------------------------------------------------------
-#ifdef BRDF_FUNCTION
+#if defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
 
 CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 
@@ -96,14 +102,24 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 	 The radiance of the ambient light in the scene.
 	 */
 	float3 g_La                     : packoffset(c2);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Light Clusters
+	//-------------------------------------------------------------------------
+
+	/**
+	 The scale and bias converting the base-2 logarithm of a camera space
+	 depth to a light cluster slice.
+	 */
+	float2 g_light_cluster_depth    : packoffset(c3);
 }
 
-#endif // BRDF_FUNCTION
+#endif // defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
 
 //-----------------------------------------------------------------------------
 // SRVs
 //-----------------------------------------------------------------------------
-#ifdef BRDF_FUNCTION
+#if defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
 
 #ifndef DISABLE_LIGHTS_DIRECTIONAL
 STRUCTURED_BUFFER(g_directional_lights, DirectionalLight,
@@ -120,6 +136,17 @@ STRUCTURED_BUFFER(g_spot_lights, SpotLight,
 				  SLOT_SRV_SPOT_LIGHTS);
 #endif // DISABLE_LIGHTS_SPOT
 
+#endif // defined(BRDF_FUNCTION) || defined(LIGHT_CLUSTERING)
+
+#ifdef BRDF_FUNCTION
+
+#ifndef DISABLE_LIGHT_CLUSTERS
+STRUCTURED_BUFFER(g_light_clusters, uint4,
+				  SLOT_SRV_LIGHT_CLUSTERS);
+STRUCTURED_BUFFER(g_light_indices, uint,
+				  SLOT_SRV_LIGHT_INDEX_LIST);
+#endif // DISABLE_LIGHT_CLUSTERS
+
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED
 
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL
@@ -170,11 +197,60 @@ float FogFactor_Exponential(float distance, float density) {
 
 #ifdef BRDF_FUNCTION
 
+/**
+ Returns the light cluster containing the given position.
+
+ @param[in]		p_world
+				The position expressed in world space.
+ @return		The offset into the light index list, the number of omni
+				lights and the number of spotlights of the light cluster
+				containing the given position.
+ */
+uint3 GetLightCluster(float3 p_world) {
+	#ifdef DISABLE_LIGHT_CLUSTERS
+	return uint3(0u, g_nb_omni_lights, g_nb_spot_lights);
+	#else  // DISABLE_LIGHT_CLUSTERS
+	const float3 p_camera = mul(float4(p_world, 1.0f), g_world_to_camera).xyz;
+	return g_light_clusters[CameraToLightCluster(p_camera,
+												 g_light_cluster_depth)].xyz;
+	#endif // DISABLE_LIGHT_CLUSTERS
+}
+
+/**
+ Returns the index of the light at the given index of the given light
+ cluster.
+
+ @param[in]		cluster
+				The light cluster.
+ @param[in]		base
+				The offset of the lights of the requested kind into the
+				light cluster (i.e. 0 for omni lights and the number of omni
+				lights for spotlights).
+ @param[in]		index
+				The index into the lights of the requested kind of the light
+				cluster.
+ @return		The index of the light into the lights of its kind.
+ */
+uint GetLightIndex(uint3 cluster, uint base, uint index) {
+	#ifdef DISABLE_LIGHT_CLUSTERS
+	// Without light clusters, each kind of light is indexed directly.
+	return index;
+	#else  // DISABLE_LIGHT_CLUSTERS
+	return g_light_indices[cluster.x + base + index];
+	#endif // DISABLE_LIGHT_CLUSTERS
+}
+
 float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 				   Material material) {
 
 	float3 L = 0.0f;
 
+	#if !defined(DISABLE_LIGHTS_OMNI) || !defined(DISABLE_LIGHTS_SPOT)
+	// The omni lights and spotlights without shadow mapping are
+	// restricted to the lights of the light cluster.
+	const uint3 cluster = GetLightCluster(p_world);
+	#endif // !defined(DISABLE_LIGHTS_OMNI) || !defined(DISABLE_LIGHTS_SPOT)
+
 	#ifndef DISABLE_LIGHTS_AMBIENT
 	// Indirect illumination: ambient lights
 	{
@@ -203,8 +279,8 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_OMNI
 	// Direct illumination: omni lights
-	for (uint i1 = 0u; i1 < g_nb_omni_lights; ++i1) {
-		const OmniLight light = g_omni_lights[i1];
+	for (uint i1 = 0u; i1 < cluster.y; ++i1) {
+		const OmniLight light = g_omni_lights[GetLightIndex(cluster, 0u, i1)];
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -221,8 +297,8 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_SPOT
 	// Direct illumination: spotlights
-	for (uint i2 = 0u; i2 < g_nb_spot_lights; ++i2) {
-		const SpotLight light = g_spot_lights[i2];
+	for (uint i2 = 0u; i2 < cluster.z; ++i2) {
+		const SpotLight light = g_spot_lights[GetLightIndex(cluster, cluster.y, i2)];
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -243,7 +319,8 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 	// Direct illumination: directional lights with shadow mapping
 	for (uint i3 = 0u; i3 < g_nb_sm_directional_lights; ++i3) {
 		const ShadowMappedDirectionalLight light = g_sm_directional_lights[i3];
-		const ShadowMap map = { g_pcf_sampler, g_directional_sms, i3 };
+		const ShadowMap map = { g_pcf_sampler, g_directional_sms,
+								i3 * SHADOW_CASCADE_COUNT };
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -281,7 +358,8 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 	// Direct illumination: spotlights with shadow mapping
 	for (uint i5 = 0u; i5 < g_nb_sm_spot_lights; ++i5) {
 		const ShadowMappedSpotLight light = g_sm_spot_lights[i5];
-		const ShadowMap map = { g_pcf_sampler, g_spot_sms, i5 };
+		const ShadowAtlasMap map = { g_pcf_sampler, g_spot_sms,
+									 light.m_shadow_tile };
 
 		// Compute the light (hit-to-light) direction and
 		// orthogonal irradiance contribution of the light.
@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Engine Configuration
+//-----------------------------------------------------------------------------
+// Defines			                        | Default
+//-----------------------------------------------------------------------------
+// GROUP_SIZE                               | LIGHT_CLUSTER_GROUP_SIZE
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#define LIGHT_CLUSTERING
+#define DISABLE_LIGHTS_DIRECTIONAL
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "lighting.hlsli"
+
+//-----------------------------------------------------------------------------
+// UAVs
+//-----------------------------------------------------------------------------
+RW_STRUCTURED_BUFFER(g_output_light_clusters, uint4, SLOT_UAV_LIGHT_CLUSTERS);
+RW_STRUCTURED_BUFFER(g_output_light_indices,  uint,  SLOT_UAV_LIGHT_INDEX_LIST);
+
+//-----------------------------------------------------------------------------
+// Compute Shader
+//-----------------------------------------------------------------------------
+
+#ifndef GROUP_SIZE
+	#define GROUP_SIZE LIGHT_CLUSTER_GROUP_SIZE
+#endif
+
+groupshared uint g_nb_cluster_lights;
+
+// Each group assigns the lights to one light cluster. The lights of each
+// light cluster are stored in a fixed range of the light index list: the
+// omni lights followed by the spotlights.
+[numthreads(GROUP_SIZE, 1, 1)]
+void CS(uint3 group_id : SV_GroupID, uint thread_index : SV_GroupIndex) {
+
+	if (0u == thread_index) {
+		g_nb_cluster_lights = 0u;
+	}
+
+	float4 planes[6];
+	GetLightClusterPlanes(group_id, g_light_cluster_depth, planes);
+
+	const uint cluster = FlattenLightCluster(group_id);
+	const uint offset  = cluster * LIGHT_CLUSTER_MAX_LIGHTS;
+
+	GroupMemoryBarrierWithGroupSync();
+
+	// Assign the omni lights.
+	for (uint i0 = thread_index; i0 < g_nb_omni_lights; i0 += GROUP_SIZE) {
+		const OmniLight light = g_omni_lights[i0];
+		const float3 p_camera = mul(float4(light.m_p_world, 1.0f),
+									g_world_to_camera).xyz;
+
+		[branch]
+		if (Overlaps(planes, p_camera, rsqrt(light.m_inv_sqr_range))) {
+			uint index;
+			InterlockedAdd(g_nb_cluster_lights, 1u, index);
+			if (index < LIGHT_CLUSTER_MAX_LIGHTS) {
+				g_output_light_indices[offset + index] = i0;
+			}
+		}
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint nb_omni_lights = min(g_nb_cluster_lights,
+									LIGHT_CLUSTER_MAX_LIGHTS);
+
+	// All threads must read the number of omni lights before any thread
+	// starts counting the spotlights.
+	GroupMemoryBarrierWithGroupSync();
+
+	// Assign the spotlights.
+	for (uint i1 = thread_index; i1 < g_nb_spot_lights; i1 += GROUP_SIZE) {
+		const SpotLight light = g_spot_lights[i1];
+		const float3 p_camera = mul(float4(light.m_p_world, 1.0f),
+									g_world_to_camera).xyz;
+
+		[branch]
+		if (Overlaps(planes, p_camera, rsqrt(light.m_inv_sqr_range))) {
+			uint index;
+			InterlockedAdd(g_nb_cluster_lights, 1u, index);
+			if (index < LIGHT_CLUSTER_MAX_LIGHTS) {
+				g_output_light_indices[offset + index] = i1;
+			}
+		}
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	if (0u == thread_index) {
+		const uint nb_lights = min(g_nb_cluster_lights,
+								   LIGHT_CLUSTER_MAX_LIGHTS);
+		g_output_light_clusters[cluster]
+			= uint4(offset, nb_omni_lights, nb_lights - nb_omni_lights, 0u);
+	}
+}
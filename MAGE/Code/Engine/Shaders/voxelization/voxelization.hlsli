@@ -12,6 +12,7 @@
 // DISABLE_BRDF_DIFFUSE                     | not defined
 // DISABLE_BRDF_SPECULAR                    | not defined
 // DISABLE_FOG                              | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // DISABLE_LIGHTS_AMBIENT                   | not defined
 // DISABLE_LIGHTS_DIRECTIONAL               | not defined
 // DISABLE_LIGHTS_OMNI                      | not defined
@@ -25,6 +26,14 @@
 // DISABLE_TSNM                             | not defined
 // DISABLE_VCT                              | not defined
 
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+// The light clusters only cover the view frustum of the camera.
+#ifndef DISABLE_LIGHT_CLUSTERS
+	#define DISABLE_LIGHT_CLUSTERS
+#endif
+
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "platform\windows.hpp"
+#include "type\scalar_types.hpp"
 
 #pragma endregion
 
@@ -354,9 +355,153 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	namespace details {
+
+		/**
+		 Checks whether the given element type provides a guid.
+
+		 @tparam		ElementT
+						The element type.
+		 */
+		template< typename ElementT, typename = void >
+		struct HasGuid : std::false_type {};
+
+		/**
+		 Checks whether the given element type provides a guid.
+
+		 @tparam		ElementT
+						The element type.
+		 */
+		template< typename ElementT >
+		struct HasGuid< ElementT, std::void_t< decltype(std::declval< const ElementT& >().GetGuid()) > >
+			: std::is_integral< decltype(std::declval< const ElementT& >().GetGuid()) > {};
+
+		/**
+		 Returns the memory resource stored in the given container element.
+
+		 @tparam		ElementT
+						The element type.
+		 @param[in]		element
+						A reference to the element.
+		 @return		A pointer to the given element.
+		 */
+		template< typename ElementT >
+		[[nodiscard]]
+		inline ElementT* GetProxyElement(ElementT& element) noexcept {
+			return &element;
+		}
+
+		/**
+		 Returns the memory resource stored in the given container element.
+
+		 @tparam		ElementT
+						The element type.
+		 @tparam		DeleterT
+						The deleter type.
+		 @param[in]		element
+						A reference to the element.
+		 @return		A pointer to the memory resource owned by the given
+						element.
+		 */
+		template< typename ElementT, typename DeleterT >
+		[[nodiscard]]
+		inline ElementT* GetProxyElement(
+			std::unique_ptr< ElementT, DeleterT >& element) noexcept {
+
+			return element.get();
+		}
+
+		/**
+		 Returns the memory resource stored at the given index of the given
+		 container.
+
+		 @tparam		ContainerT
+						The container type.
+		 @param[in]		elements
+						A reference to the container.
+		 @param[in]		index
+						The index into the container.
+		 @return		A pointer to the memory resource stored at the given
+						index of the given container. @c nullptr if @a index
+						is out of range.
+		 */
+		template< typename ContainerT >
+		[[nodiscard]]
+		inline auto* GetProxyElementAt(ContainerT& elements,
+									   std::size_t index) noexcept {
+
+			decltype(GetProxyElement(elements[index])) element = nullptr;
+			if (index < elements.size()) {
+				element = GetProxyElement(elements[index]);
+			}
+
+			return element;
+		}
+
+		/**
+		 Returns the generation of the given memory resource.
+
+		 @tparam		ElementT
+						The element type.
+		 @param[in]		element
+						A pointer to the memory resource.
+		 @return		The guid of the given memory resource if its type
+						provides guids. 0 otherwise.
+		 */
+		template< typename ElementT >
+		[[nodiscard]]
+		inline U64 GetProxyGeneration(const ElementT* element) noexcept {
+			if constexpr (HasGuid< ElementT >::value) {
+				return element ? static_cast< U64 >(element->GetGuid()) : 0u;
+			}
+			else {
+				return 0u;
+			}
+		}
+
+		/**
+		 Returns the memory resource at the given index of the given container
+		 if it still has the given generation.
+
+		 @tparam		ContainerT
+						The container type.
+		 @param[in]		container
+						A pointer to the container.
+		 @param[in]		index
+						The index into the container.
+		 @param[in]		generation
+						The generation of the memory resource.
+		 @return		A pointer to the memory resource at the given index of
+						the given container if it still has the given
+						generation. @c nullptr otherwise.
+		 */
+		template< typename ContainerT >
+		[[nodiscard]]
+		void* GetProxyResource(void* container,
+							   std::size_t index,
+							   U64 generation) noexcept {
+
+			auto& elements = *static_cast< ContainerT* >(container);
+			auto* const element = GetProxyElementAt(elements, index);
+			if (nullptr == element
+				|| generation != GetProxyGeneration(element)) {
+				return nullptr;
+			}
+
+			return const_cast< void* >(static_cast< const void* >(element));
+		}
+	}
+
 	/**
 	 A class of proxy pointers.
 
+	 A proxy pointer is a generational handle to an element of a container:
+	 it stores the container, the index into the container and the generation
+	 of the element (i.e. its guid, if provided). The element is looked up on
+	 each dereference, so proxy pointers remain valid if the container
+	 reallocates its elements. A proxy pointer resolves to @c nullptr if its
+	 index is out of range or if its slot has been reused by another element.
+
 	 @tparam		T
 					The memory resource type.
 	 */
@@ -365,6 +510,15 @@ namespace mage {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of getter functions of proxy pointers.
+		 */
+		using GetterFunction = void* (*)(void*, std::size_t, U64) noexcept;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -372,20 +526,23 @@ namespace mage {
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr() noexcept
-			: ProxyPtr([]() noexcept -> T* {
-				return nullptr;
-			}) {}
+		constexpr ProxyPtr() noexcept
+			: m_container(nullptr),
+			m_getter(nullptr),
+			m_generation(0u),
+			m_index(0u),
+			m_offset(0) {}
 
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr(std::nullptr_t) noexcept
+		constexpr ProxyPtr(std::nullptr_t) noexcept
 			: ProxyPtr() {}
 
 		/**
 		 Constructs a proxy pointer for the given container and index.
 
+		 @pre			@a index refers to an element of @a container.
 		 @tparam		ContainerT
 						The container type.
 		 @param[in]		container
@@ -395,18 +552,52 @@ namespace mage {
 		 */
 		template< typename ContainerT >
 		explicit ProxyPtr(ContainerT& container, std::size_t index) noexcept
-			: ProxyPtr([&container, index]() noexcept {
-				return &container[index];
-			}) {}
+			: m_container(&container),
+			m_getter(&details::GetProxyResource< ContainerT >),
+			m_generation(0u),
+			m_index(static_cast< U32 >(index)),
+			m_offset(0) {
+
+			using details::GetProxyElementAt;
+			auto* const element = GetProxyElementAt(container, index);
+			m_generation = details::GetProxyGeneration(element);
+			m_offset     = GetOffset(element, static_cast< T* >(element));
+		}
 
 		/**
-		 Constructs a proxy pointer with the given getter function.
+		 Constructs a proxy pointer which shares the container, index and
+		 generation of the given proxy pointer, but points to the given
+		 memory resource instead. The constructed proxy pointer is
+		 @c nullptr if @a from or @a to is @c nullptr (e.g., a failed
+		 dynamic cast), instead of sharing the handle of @a ptr.
 
-		 @param[in]		getter
-						The getter function.
+		 @tparam		FromT
+						The memory resource type.
+		 @param[in]		ptr
+						A reference to the proxy pointer.
+		 @param[in]		from
+						A pointer to the memory resource currently pointed to
+						by @a ptr.
+		 @param[in]		to
+						A pointer to the memory resource within the memory
+						resource pointed to by @a from.
 		 */
-		explicit ProxyPtr(std::function< T*() > getter) noexcept
-			: m_getter(std::move(getter)) {}
+		template< typename FromT >
+		explicit ProxyPtr(const ProxyPtr< FromT >& ptr,
+						  FromT* from, T* to) noexcept
+			: m_container(ptr.m_container),
+			m_getter(ptr.m_getter),
+			m_generation(ptr.m_generation),
+			m_index(ptr.m_index),
+			m_offset(ptr.m_offset) {
+
+			if (nullptr == from || nullptr == to) {
+				*this = nullptr;
+				return;
+			}
+
+			m_offset += GetOffset(from, to);
+		}
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -414,8 +605,7 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer.
 		 */
-		ProxyPtr(const ProxyPtr& ptr) noexcept
-			: m_getter(ptr.m_getter) {}
+		constexpr ProxyPtr(const ProxyPtr& ptr) noexcept = default;
 
 		/**
 		 Constructs a proxy pointer by moving the given proxy pointer.
@@ -423,7 +613,7 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer to move.
 		 */
-		ProxyPtr(ProxyPtr&& ptr) noexcept = default;
+		constexpr ProxyPtr(ProxyPtr&& ptr) noexcept = default;
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -436,20 +626,7 @@ namespace mage {
 		template< typename FromT,
 			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
 		ProxyPtr(const ProxyPtr< FromT >& ptr) noexcept
-			: ProxyPtr(ptr.m_getter) {}
-
-		/**
-		 Constructs a proxy pointer by moving the given proxy pointer.
-
-		 @tparam		FromT
-						The memory resource type.
-		 @param[in]		ptr
-						A reference to the proxy pointer to move.
-		 */
-		template< typename FromT,
-			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
-		ProxyPtr(ProxyPtr< FromT >&& ptr) noexcept
-			: ProxyPtr(std::move(ptr.m_getter)) {}
+			: ProxyPtr(ptr, ptr.Get(), ptr.Get()) {}
 
 		/**
 		 Destructs this proxy pointer.
@@ -468,10 +645,7 @@ namespace mage {
 		 @return		A reference to the copy of the given proxy pointer
 						(i.e. this proxy pointer).
 		 */
-		ProxyPtr& operator=(const ProxyPtr& ptr) noexcept {
-			m_getter = ptr.m_getter;
-			return *this;
-		}
+		ProxyPtr& operator=(const ProxyPtr& ptr) noexcept = default;
 
 		/**
 		 Moves the given proxy pointer to this proxy pointer.
@@ -481,10 +655,7 @@ namespace mage {
 		 @return		A reference to the moved proxy pointer (i.e. this proxy
 						pointer).
 		 */
-		ProxyPtr& operator=(ProxyPtr&& ptr) noexcept {
-			m_getter = std::move(ptr.m_getter);
-			return *this;
-		}
+		ProxyPtr& operator=(ProxyPtr&& ptr) noexcept = default;
 
 		//---------------------------------------------------------------------
 		// Member Methods
@@ -523,11 +694,18 @@ namespace mage {
 		 Returns the memory resource pointed to by this proxy pointer.
 
 		 @return		A pointer to the memory resource pointed to by this
-						proxy pointer.
+						proxy pointer. @c nullptr if this proxy pointer is
+						stale.
 		 */
 		[[nodiscard]]
 		T* Get() const noexcept {
-			return m_getter();
+			if (nullptr == m_getter) {
+				return nullptr;
+			}
+
+			auto* const element = static_cast< U8* >(
+				m_getter(m_container, m_index, m_generation));
+			return element ? reinterpret_cast< T* >(element + m_offset) : nullptr;
 		}
 
 		/**
@@ -567,10 +745,55 @@ namespace mage {
 		// Member Variables
 		//---------------------------------------------------------------------
 
+		/**
+		 A pointer to the container of this proxy pointer.
+		 */
+		void* m_container;
+
 		/**
 		 The getter of this proxy pointer.
 		 */
-		std::function< T*() > m_getter;
+		GetterFunction m_getter;
+
+		/**
+		 The generation of the element of this proxy pointer.
+		 */
+		U64 m_generation;
+
+		/**
+		 The index into the container of this proxy pointer.
+		 */
+		U32 m_index;
+
+		/**
+		 The offset in bytes from the element of this proxy pointer to the
+		 memory resource pointed to by this proxy pointer.
+		 */
+		S32 m_offset;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the offset in bytes between the given memory resources.
+
+		 @param[in]		from
+						A pointer to the first memory resource.
+		 @param[in]		to
+						A pointer to the second memory resource.
+		 @return		The offset in bytes from @a from to @a to.
+		 */
+		[[nodiscard]]
+		static S32 GetOffset(const volatile void* from,
+							 const volatile void* to) noexcept {
+
+			return static_cast< S32 >(
+				static_cast< const volatile U8* >(to)
+				- static_cast< const volatile U8* >(from));
+		}
 	};
 
 	/**
@@ -638,8 +861,8 @@ namespace mage {
 	}
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by statically
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -653,8 +876,8 @@ namespace mage {
 	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by statically
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -665,11 +888,11 @@ namespace mage {
 	 @return		The moved proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
+	ProxyPtr< ToT > static_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by dynamically
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -677,14 +900,16 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
+	 @return		@c nullptr if the memory resource of the given proxy
+					pointer is not a @a ToT.
 	 @return		The moved proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > dynamic_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by dynamically
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -692,14 +917,16 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
+	 @return		@c nullptr if the memory resource of the given proxy
+					pointer is not a @a ToT.
 	 @return		The moved proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > dynamic_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by const
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by const
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -713,8 +940,8 @@ namespace mage {
 	ProxyPtr< ToT > const_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by const
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by const
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -728,8 +955,8 @@ namespace mage {
 	ProxyPtr< ToT > const_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by reinterpret
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -743,8 +970,8 @@ namespace mage {
 	ProxyPtr< ToT > reinterpret_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose memory resource is obtained by reinterpret
+	 casting the memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -0,0 +1,198 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <exception>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of frame pipelines.
+
+	 A frame pipeline double buffers the frames passed from a producing stage
+	 to a preparing stage. The producing thread extracts a frame in one buffer
+	 while a job of the job system prepares the previously extracted frame in
+	 the other buffer. The prepared frame remains available till the next
+	 frame is scheduled for preparation.
+
+	 @tparam		FrameT
+					The frame type.
+	 */
+	template< typename FrameT >
+	class FramePipeline {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame pipeline.
+
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 */
+		explicit FramePipeline(JobSystem& job_system);
+
+		/**
+		 Constructs a frame pipeline from the given frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to copy.
+		 */
+		FramePipeline(const FramePipeline& pipeline) = delete;
+
+		/**
+		 Constructs a frame pipeline by moving the given frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to move.
+		 */
+		FramePipeline(FramePipeline&& pipeline) = delete;
+
+		/**
+		 Destructs this frame pipeline. The frame in preparation is finished
+		 first.
+		 */
+		~FramePipeline();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame pipeline to this frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to copy.
+		 @return		A reference to the copy of the given frame pipeline
+						(i.e. this frame pipeline).
+		 */
+		FramePipeline& operator=(const FramePipeline& pipeline) = delete;
+
+		/**
+		 Moves the given frame pipeline to this frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to move.
+		 @return		A reference to the moved frame pipeline (i.e. this
+						frame pipeline).
+		 */
+		FramePipeline& operator=(FramePipeline&& pipeline) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the frame of this frame pipeline to extract in. This frame
+		 is never accessed by the preparing stage.
+
+		 @return		A reference to the frame of this frame pipeline to
+						extract in.
+		 */
+		[[nodiscard]]
+		FrameT& GetExtractionFrame() noexcept {
+			return m_frames[m_extraction_index];
+		}
+
+		/**
+		 Schedules the preparation of the extraction frame of this frame
+		 pipeline. The other frame becomes the extraction frame.
+
+		 @tparam		PrepareT
+						The preparation function type. The function must
+						accept a @c FrameT& value.
+		 @param[in]		prepare
+						The preparation function.
+		 @throws		Exception
+						Failed to prepare the previous frame.
+		 */
+		template< typename PrepareT >
+		void Prepare(PrepareT&& prepare);
+
+		/**
+		 Waits for the preparation of the last scheduled frame of this frame
+		 pipeline to finish.
+
+		 @return		A pointer to the last scheduled frame of this frame
+						pipeline. @c nullptr if no frame has been scheduled
+						since the last reset.
+		 @throws		Exception
+						Failed to prepare the frame.
+		 */
+		[[nodiscard]]
+		FrameT* Wait();
+
+		/**
+		 Waits for the preparation of the last scheduled frame of this frame
+		 pipeline to finish and forgets that frame.
+		 */
+		void Reset() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the job system of this frame pipeline.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
+		/**
+		 The frames of this frame pipeline.
+		 */
+		FrameT m_frames[2];
+
+		/**
+		 The index of the extraction frame of this frame pipeline.
+		 */
+		std::size_t m_extraction_index;
+
+		/**
+		 A pointer to the last scheduled frame of this frame pipeline.
+		 */
+		FrameT* m_prepared_frame;
+
+		/**
+		 The job counter of the preparation of this frame pipeline.
+		 */
+		JobCounter m_counter;
+
+		/**
+		 A pointer to the exception thrown by the last preparation of this
+		 frame pipeline.
+		 */
+		std::exception_ptr m_exception;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\frame_pipeline.tpp"
+
+#pragma endregion
@@ -0,0 +1,65 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename FrameT >
+	FramePipeline< FrameT >::FramePipeline(JobSystem& job_system)
+		: m_job_system(job_system),
+		m_frames(),
+		m_extraction_index(0u),
+		m_prepared_frame(nullptr),
+		m_counter(),
+		m_exception() {}
+
+	template< typename FrameT >
+	FramePipeline< FrameT >::~FramePipeline() {
+		Reset();
+	}
+
+	template< typename FrameT >
+	template< typename PrepareT >
+	void FramePipeline< FrameT >::Prepare(PrepareT&& prepare) {
+		// The previously scheduled frame becomes the next extraction frame.
+		[[maybe_unused]] const auto previous_frame = Wait();
+
+		const auto frame   = &m_frames[m_extraction_index];
+		m_extraction_index = 1u - m_extraction_index;
+		m_prepared_frame   = frame;
+
+		m_job_system.get().Execute(
+			[this, frame, prepare = std::forward< PrepareT >(prepare)]() {
+				try {
+					prepare(*frame);
+				}
+				catch (...) {
+					m_exception = std::current_exception();
+				}
+			},
+			m_counter);
+	}
+
+	template< typename FrameT >
+	[[nodiscard]]
+	FrameT* FramePipeline< FrameT >::Wait() {
+		m_job_system.get().Wait(m_counter);
+
+		if (m_exception) {
+			// A frame which failed to prepare is not available.
+			m_prepared_frame = nullptr;
+			std::rethrow_exception(std::exchange(m_exception, nullptr));
+		}
+
+		return m_prepared_frame;
+	}
+
+	template< typename FrameT >
+	void FramePipeline< FrameT >::Reset() noexcept {
+		m_job_system.get().Wait(m_counter);
+
+		m_exception      = nullptr;
+		m_prepared_frame = nullptr;
+	}
+}
@@ -0,0 +1,253 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of attempts of an idle worker to find a job before
+		 sleeping.
+		 */
+		constexpr std::size_t g_nb_spins = 64u;
+
+		/**
+		 A pointer to the job system of the worker of the calling thread.
+		 */
+		thread_local const JobSystem* g_job_system = nullptr;
+
+		/**
+		 The index of the worker of the calling thread.
+		 */
+		thread_local std::size_t g_worker_index = 0u;
+
+		/**
+		 The state of the random number generator of the calling thread.
+		 */
+		thread_local U32 g_random_state = 0u;
+
+		/**
+		 Returns the next random number of the calling thread.
+
+		 @return		The next random number of the calling thread.
+		 */
+		[[nodiscard]]
+		U32 GetNextRandom() noexcept {
+			if (0u == g_random_state) {
+				g_random_state = static_cast< U32 >(
+					std::hash< std::thread::id >()(std::this_thread::get_id())) | 1u;
+			}
+
+			// Xorshift32
+			g_random_state ^= g_random_state << 13u;
+			g_random_state ^= g_random_state >> 17u;
+			g_random_state ^= g_random_state << 5u;
+			return g_random_state;
+		}
+	}
+
+	JobSystem::JobSystem()
+		: JobSystem(NumberOfPhysicalCores()) {}
+
+	JobSystem::JobSystem(std::size_t nb_workers)
+		: m_workers(),
+		m_shared_jobs(),
+		m_mutex(),
+		m_condition(),
+		m_nb_pending_jobs(0u),
+		m_nb_sleeping_workers(0u),
+		m_stop(false) {
+
+		nb_workers = std::max(nb_workers, std::size_t(1u));
+
+		m_workers.reserve(nb_workers);
+		for (std::size_t i = 0u; i < nb_workers; ++i) {
+			m_workers.push_back(MakeUnique< Worker >());
+		}
+
+		// The calling thread is the first worker.
+		g_job_system   = this;
+		g_worker_index = 0u;
+
+		for (std::size_t i = 1u; i < nb_workers; ++i) {
+			m_workers[i]->m_thread = std::thread(&JobSystem::Run, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_stop.store(true);
+		}
+		m_condition.notify_all();
+
+		for (const auto& worker : m_workers) {
+			if (worker->m_thread.joinable()) {
+				worker->m_thread.join();
+			}
+		}
+
+		while (TryExecute()) {}
+
+		if (this == g_job_system) {
+			g_job_system = nullptr;
+		}
+	}
+
+	void JobSystem::Execute(JobFunction job, JobCounter& counter) {
+		auto ptr = MakeUnique< Job >();
+		ptr->m_function = std::move(job);
+		ptr->m_counter  = &counter;
+
+		counter.m_count.fetch_add(1u, std::memory_order_relaxed);
+		Schedule(ptr.get());
+		ptr.release();
+	}
+
+	void JobSystem::Execute(JobFunction job, JobCounter& counter,
+							const JobCounter& dependency) {
+
+		Execute([this, &dependency, job(std::move(job))]() {
+			Wait(dependency);
+			job();
+		}, counter);
+	}
+
+	void JobSystem::Wait(const JobCounter& counter) {
+		WaitForJobs(counter);
+
+		if (counter.m_failed.load(std::memory_order_acquire)) {
+			std::rethrow_exception(counter.m_exception);
+		}
+	}
+
+	void JobSystem::WaitForJobs(const JobCounter& counter) noexcept {
+		while (!counter.IsDone()) {
+			if (!TryExecute()) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::Run(std::size_t index) noexcept {
+		g_job_system   = this;
+		g_worker_index = index;
+
+		while (!m_stop.load()) {
+			bool executed = false;
+			for (std::size_t i = 0u; i < g_nb_spins && !executed; ++i) {
+				executed = TryExecute();
+				if (!executed) {
+					std::this_thread::yield();
+				}
+			}
+
+			if (executed) {
+				continue;
+			}
+
+			std::unique_lock< std::mutex > lock(m_mutex);
+			m_nb_sleeping_workers.fetch_add(1u);
+			m_condition.wait(lock, [this]() noexcept {
+				return m_stop.load() || 0u != m_nb_pending_jobs.load();
+			});
+			m_nb_sleeping_workers.fetch_sub(1u);
+		}
+	}
+
+	void JobSystem::Schedule(Job* job) {
+		m_nb_pending_jobs.fetch_add(1u);
+
+		if (const auto index = GetWorkerIndex(); index < m_workers.size()) {
+			m_workers[index]->m_jobs.Push(job);
+		}
+		else {
+			const std::scoped_lock lock(m_mutex);
+			m_shared_jobs.push_back(job);
+		}
+
+		// A sleeping worker either observes the pending job before sleeping,
+		// or is sleeping while the mutex is acquired here.
+		if (0u != m_nb_sleeping_workers.load()) {
+			{
+				const std::scoped_lock lock(m_mutex);
+			}
+			m_condition.notify_one();
+		}
+	}
+
+	bool JobSystem::TryExecute() noexcept {
+		const UniquePtr< Job > job(Find());
+		if (!job) {
+			return false;
+		}
+
+		try {
+			job->m_function();
+		}
+		catch (...) {
+			// Only the first exception of a job counter is stored.
+			if (auto& counter = *job->m_counter; !counter.m_failed.exchange(true)) {
+				counter.m_exception = std::current_exception();
+			}
+		}
+
+		job->m_counter->m_count.fetch_sub(1u, std::memory_order_release);
+		return true;
+	}
+
+	[[nodiscard]]
+	JobSystem::Job* JobSystem::Find() noexcept {
+		const auto nb_workers = m_workers.size();
+		const auto index      = GetWorkerIndex();
+
+		// Pop a job of the worker of the calling thread.
+		if (index < nb_workers) {
+			if (const auto job = m_workers[index]->m_jobs.Pop(); job) {
+				m_nb_pending_jobs.fetch_sub(1u);
+				return *job;
+			}
+		}
+
+		// Take a job scheduled by a thread which is no worker.
+		if (std::unique_lock< std::mutex > lock(m_mutex, std::try_to_lock);
+			lock.owns_lock() && !m_shared_jobs.empty()) {
+
+			const auto job = m_shared_jobs.back();
+			m_shared_jobs.pop_back();
+			m_nb_pending_jobs.fetch_sub(1u);
+			return job;
+		}
+
+		// Steal a job of another worker.
+		const auto first = static_cast< std::size_t >(GetNextRandom());
+		for (std::size_t i = 0u; i < nb_workers; ++i) {
+			const auto victim = (first + i) % nb_workers;
+			if (victim == index) {
+				continue;
+			}
+
+			if (const auto job = m_workers[victim]->m_jobs.Steal(); job) {
+				m_nb_pending_jobs.fetch_sub(1u);
+				return *job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	[[nodiscard]]
+	std::size_t JobSystem::GetWorkerIndex() const noexcept {
+		return (this == g_job_system) ? g_worker_index : m_workers.size();
+	}
+}
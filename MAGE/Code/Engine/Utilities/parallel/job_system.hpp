@@ -0,0 +1,476 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\work_stealing_deque.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// JobCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job counters.
+
+	 A job counter counts the unfinished jobs which were scheduled with it.
+	 Jobs can wait for a job counter to express dependencies. A job counter
+	 also stores the first exception thrown by one of its jobs.
+	 */
+	class JobCounter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job counter.
+		 */
+		JobCounter() noexcept
+			: m_count(0u),
+			m_failed(false),
+			m_exception() {}
+
+		/**
+		 Constructs a job counter from the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 */
+		JobCounter(const JobCounter& counter) = delete;
+
+		/**
+		 Constructs a job counter by moving the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 */
+		JobCounter(JobCounter&& counter) = delete;
+
+		/**
+		 Destructs this job counter.
+		 */
+		~JobCounter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 @return		A reference to the copy of the given job counter (i.e.
+						this job counter).
+		 */
+		JobCounter& operator=(const JobCounter& counter) = delete;
+
+		/**
+		 Moves the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 @return		A reference to the moved job counter (i.e. this job
+						counter).
+		 */
+		JobCounter& operator=(JobCounter&& counter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether all jobs of this job counter are finished.
+
+		 @return		@c true if all jobs of this job counter are finished.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDone() const noexcept {
+			return 0u == m_count.load(std::memory_order_acquire);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend class JobSystem;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of unfinished jobs of this job counter.
+		 */
+		AtomicU32 m_count;
+
+		/**
+		 A flag indicating whether a job of this job counter threw an
+		 exception.
+		 */
+		AtomicBool m_failed;
+
+		/**
+		 A pointer to the first exception thrown by a job of this job
+		 counter.
+		 */
+		std::exception_ptr m_exception;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// JobSystem
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job systems.
+
+	 A job system owns a worker thread per core (the thread constructing the
+	 job system acts as the first worker). Each worker owns a work-stealing
+	 deque: jobs are pushed to and popped from the deque of the scheduling
+	 worker, and idle workers steal jobs from the other deques. Jobs scheduled
+	 by threads which are no workers go through a shared queue. Waiting for
+	 a job counter executes pending jobs instead of blocking.
+	 */
+	class JobSystem {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of job functions.
+		 */
+		using JobFunction = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job system with a worker per physical core.
+
+		 @throws		Exception
+						Failed to retrieve the number of physical cores.
+		 */
+		JobSystem();
+
+		/**
+		 Constructs a job system.
+
+		 @param[in]		nb_workers
+						The number of workers, including the calling thread.
+		 */
+		explicit JobSystem(std::size_t nb_workers);
+
+		/**
+		 Constructs a job system from the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 */
+		JobSystem(const JobSystem& job_system) = delete;
+
+		/**
+		 Constructs a job system by moving the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 */
+		JobSystem(JobSystem&& job_system) = delete;
+
+		/**
+		 Destructs this job system. Pending jobs are executed first.
+		 */
+		~JobSystem();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 @return		A reference to the copy of the given job system (i.e.
+						this job system).
+		 */
+		JobSystem& operator=(const JobSystem& job_system) = delete;
+
+		/**
+		 Moves the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 @return		A reference to the moved job system (i.e. this job
+						system).
+		 */
+		JobSystem& operator=(JobSystem&& job_system) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of workers of this job system.
+
+		 @return		The number of workers of this job system, including
+						the thread which constructed this job system.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfWorkers() const noexcept {
+			return m_workers.size();
+		}
+
+		/**
+		 Schedules the given job. An exception thrown by @a job is stored in
+		 @a counter and rethrown when waiting for @a counter.
+
+		 @param[in]		job
+						The job.
+		 @param[in,out]	counter
+						A reference to the job counter to increment now and
+						to decrement once @a job finished.
+		 */
+		void Execute(JobFunction job, JobCounter& counter);
+
+		/**
+		 Schedules the given job which depends on the jobs of the given
+		 job counter. An exception thrown by @a job or by a job of
+		 @a dependency is stored in @a counter and rethrown when waiting for
+		 @a counter.
+
+		 @pre			@a dependency outlives the execution of @a job.
+		 @param[in]		job
+						The job.
+		 @param[in,out]	counter
+						A reference to the job counter to increment now and
+						to decrement once @a job finished.
+		 @param[in]		dependency
+						A reference to the job counter to wait for before
+						executing @a job.
+		 */
+		void Execute(JobFunction job, JobCounter& counter,
+					 const JobCounter& dependency);
+
+		/**
+		 Waits for all jobs of the given job counter to finish. The calling
+		 thread executes pending jobs while waiting. Once all jobs finished,
+		 the first exception thrown by a job of the given job counter (if
+		 any) is rethrown.
+
+		 @param[in]		counter
+						A reference to the job counter.
+		 */
+		void Wait(const JobCounter& counter);
+
+		/**
+		 Applies the given function to all indices of the given range in
+		 parallel and waits till all indices are processed. If @a function
+		 throws, the first exception is rethrown once all indices are
+		 processed.
+
+		 @tparam		FunctionT
+						The function type. Either invocable with an index
+						or with a begin and end index of a subrange.
+		 @param[in]		begin
+						The begin index.
+		 @param[in]		end
+						The end index.
+		 @param[in]		function
+						A reference to the function.
+		 @param[in]		grain_size
+						The minimum number of indices per job. If zero, the
+						range is split in a few jobs per worker.
+		 */
+		template< typename FunctionT >
+		void ParallelFor(std::size_t begin, std::size_t end,
+						 FunctionT&& function, std::size_t grain_size = 0u);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of jobs.
+		 */
+		struct Job {
+
+		public:
+
+			/**
+			 The function of this job.
+			 */
+			JobFunction m_function;
+
+			/**
+			 A pointer to the job counter of this job.
+			 */
+			JobCounter* m_counter;
+		};
+
+		/**
+		 A struct of workers.
+		 */
+		struct Worker {
+
+		public:
+
+			/**
+			 The jobs of this worker.
+			 */
+			WorkStealingDeque< Job* > m_jobs;
+
+			/**
+			 The thread of this worker.
+			 */
+			std::thread m_thread;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Runs the loop of the worker with the given index.
+
+		 @param[in]		index
+						The index of the worker.
+		 */
+		void Run(std::size_t index) noexcept;
+
+		/**
+		 Schedules the given job.
+
+		 @param[in]		job
+						A pointer to the job.
+		 */
+		void Schedule(Job* job);
+
+		/**
+		 Tries to execute a pending job.
+
+		 @return		@c true if a pending job is executed. @c false
+						otherwise.
+		 */
+		bool TryExecute() noexcept;
+
+		/**
+		 Waits for all jobs of the given job counter to finish without
+		 rethrowing their exceptions. The calling thread executes pending jobs
+		 while waiting.
+
+		 @param[in]		counter
+						A reference to the job counter.
+		 */
+		void WaitForJobs(const JobCounter& counter) noexcept;
+
+		/**
+		 Returns a pending job.
+
+		 @return		A pointer to a pending job. @c nullptr if no pending
+						jobs are found.
+		 */
+		[[nodiscard]]
+		Job* Find() noexcept;
+
+		/**
+		 Returns the index of the worker of the calling thread.
+
+		 @return		The index of the worker of the calling thread, or the
+						number of workers if the calling thread is no worker
+						of this job system.
+		 */
+		[[nodiscard]]
+		std::size_t GetWorkerIndex() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the workers of this job system.
+		 */
+		std::vector< UniquePtr< Worker > > m_workers;
+
+		/**
+		 A vector containing the jobs scheduled by threads which are no
+		 workers of this job system.
+		 */
+		std::vector< Job* > m_shared_jobs;
+
+		/**
+		 The mutex protecting the shared jobs and the sleeping workers of
+		 this job system.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable to wake up sleeping workers of this job
+		 system.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The number of scheduled jobs of this job system which are not
+		 started yet.
+		 */
+		AtomicU32 m_nb_pending_jobs;
+
+		/**
+		 The number of sleeping workers of this job system.
+		 */
+		AtomicU32 m_nb_sleeping_workers;
+
+		/**
+		 A flag indicating whether the workers of this job system must stop.
+		 */
+		AtomicBool m_stop;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.tpp"
+
+#pragma endregion
@@ -0,0 +1,61 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename FunctionT >
+	void JobSystem::ParallelFor(std::size_t begin, std::size_t end,
+								FunctionT&& function, std::size_t grain_size) {
+		if (end <= begin) {
+			return;
+		}
+
+		if (0u == grain_size) {
+			// A few jobs per worker to balance the load.
+			grain_size = std::max((end - begin) / (4u * GetNumberOfWorkers()),
+								  std::size_t(1u));
+		}
+
+		const auto process = [&function](std::size_t first, std::size_t last) {
+			if constexpr (std::is_invocable_v< FunctionT, std::size_t, std::size_t >) {
+				function(first, last);
+			}
+			else {
+				for (auto i = first; i < last; ++i) {
+					function(i);
+				}
+			}
+		};
+
+		JobCounter counter;
+		for (auto first = begin + grain_size; first < end; first += grain_size) {
+			const auto last = std::min(first + grain_size, end);
+			Execute([&process, first, last]() {
+				process(first, last);
+			}, counter);
+		}
+
+		// The calling thread processes the first subrange itself.
+		try {
+			process(begin, std::min(begin + grain_size, end));
+		}
+		catch (...) {
+			// The scheduled jobs reference process and counter.
+			WaitForJobs(counter);
+			throw;
+		}
+
+		Wait(counter);
+	}
+}
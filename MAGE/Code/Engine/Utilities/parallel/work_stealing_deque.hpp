@@ -0,0 +1,290 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of work-stealing deques (Chase-Lev).
+
+	 The owner thread pushes and pops items at the bottom of a work-stealing
+	 deque, while any other thread may steal items from the top. Only the
+	 owner thread may call @c Push and @c Pop.
+
+	 @tparam		T
+					The (trivially copyable) item type.
+	 */
+	template< typename T >
+	class WorkStealingDeque {
+
+	public:
+
+		static_assert(std::is_trivially_copyable_v< T >);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a work-stealing deque.
+
+		 @param[in]		capacity
+						The initial capacity. Rounded up to a power of two.
+		 */
+		explicit WorkStealingDeque(std::size_t capacity = 1024u);
+
+		/**
+		 Constructs a work-stealing deque from the given work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 */
+		WorkStealingDeque(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Constructs a work-stealing deque by moving the given work-stealing
+		 deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 */
+		WorkStealingDeque(WorkStealingDeque&& deque) = delete;
+
+		/**
+		 Destructs this work-stealing deque.
+		 */
+		~WorkStealingDeque() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 @return		A reference to the copy of the given work-stealing
+						deque (i.e. this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Moves the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 @return		A reference to the moved work-stealing deque (i.e.
+						this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(WorkStealingDeque&& deque) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this work-stealing deque is empty.
+
+		 @return		@c true if this work-stealing deque is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept;
+
+		/**
+		 Returns the number of items of this work-stealing deque.
+
+		 @return		The (approximate) number of items of this work-stealing
+						deque.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept;
+
+		/**
+		 Pushes the given item at the bottom of this work-stealing deque.
+
+		 @pre			The calling thread is the owner thread.
+		 @param[in]		item
+						The item.
+		 */
+		void Push(T item);
+
+		/**
+		 Pops an item from the bottom of this work-stealing deque.
+
+		 @pre			The calling thread is the owner thread.
+		 @return		The popped item if this work-stealing deque is not
+						empty.
+		 */
+		[[nodiscard]]
+		std::optional< T > Pop() noexcept;
+
+		/**
+		 Steals an item from the top of this work-stealing deque.
+
+		 @return		The stolen item if this work-stealing deque is not
+						empty and no other thread won the race for it.
+		 */
+		[[nodiscard]]
+		std::optional< T > Steal() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A class of circular arrays.
+		 */
+		class Array {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a circular array.
+
+			 @param[in]		capacity
+							The capacity (a power of two).
+			 */
+			explicit Array(std::size_t capacity)
+				: m_mask(capacity - 1u),
+				m_items(MakeUnique< std::atomic< T >[] >(capacity)) {}
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the capacity of this circular array.
+
+			 @return		The capacity of this circular array.
+			 */
+			[[nodiscard]]
+			std::size_t GetCapacity() const noexcept {
+				return m_mask + 1u;
+			}
+
+			/**
+			 Returns the item at the given (unwrapped) index of this circular
+			 array.
+
+			 @param[in]		index
+							The index.
+			 @return		The item at the given index of this circular
+							array.
+			 */
+			[[nodiscard]]
+			T Get(S64 index) const noexcept {
+				return m_items[static_cast< std::size_t >(index) & m_mask]
+					.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 Sets the item at the given (unwrapped) index of this circular
+			 array.
+
+			 @param[in]		index
+							The index.
+			 @param[in]		item
+							The item.
+			 */
+			void Put(S64 index, T item) noexcept {
+				m_items[static_cast< std::size_t >(index) & m_mask]
+					.store(item, std::memory_order_relaxed);
+			}
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The index mask of this circular array.
+			 */
+			std::size_t m_mask;
+
+			/**
+			 A pointer to the items of this circular array.
+			 */
+			UniquePtr< std::atomic< T >[] > m_items;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Doubles the capacity of the array of this work-stealing deque.
+
+		 @param[in]		top
+						The top index.
+		 @param[in]		bottom
+						The bottom index.
+		 @return		A pointer to the new array.
+		 */
+		Array* Grow(S64 top, S64 bottom);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The top index of this work-stealing deque (modified by thieves).
+		 */
+		alignas(64) std::atomic< S64 > m_top;
+
+		/**
+		 The bottom index of this work-stealing deque (modified by the
+		 owner).
+		 */
+		alignas(64) std::atomic< S64 > m_bottom;
+
+		/**
+		 A pointer to the current array of this work-stealing deque.
+		 */
+		alignas(64) std::atomic< Array* > m_array;
+
+		/**
+		 A vector containing all arrays of this work-stealing deque. Older
+		 arrays stay alive, since thieves may still read from them.
+		 */
+		std::vector< UniquePtr< Array > > m_arrays;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\work_stealing_deque.tpp"
+
+#pragma endregion
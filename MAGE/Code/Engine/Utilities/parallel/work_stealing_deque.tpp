@@ -0,0 +1,118 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename T >
+	WorkStealingDeque< T >::WorkStealingDeque(std::size_t capacity)
+		: m_top(0),
+		m_bottom(0),
+		m_array(),
+		m_arrays() {
+
+		std::size_t pow2_capacity = 1u;
+		while (pow2_capacity < capacity) {
+			pow2_capacity <<= 1u;
+		}
+
+		m_arrays.push_back(MakeUnique< Array >(pow2_capacity));
+		m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline bool WorkStealingDeque< T >::empty() const noexcept {
+		return 0u == size();
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline std::size_t WorkStealingDeque< T >::size() const noexcept {
+		const auto bottom = m_bottom.load(std::memory_order_relaxed);
+		const auto top    = m_top.load(std::memory_order_relaxed);
+		return static_cast< std::size_t >(std::max(bottom - top, S64(0)));
+	}
+
+	template< typename T >
+	void WorkStealingDeque< T >::Push(T item) {
+		const auto bottom = m_bottom.load(std::memory_order_relaxed);
+		const auto top    = m_top.load(std::memory_order_acquire);
+		auto array        = m_array.load(std::memory_order_relaxed);
+
+		if (static_cast< S64 >(array->GetCapacity()) - 1 < bottom - top) {
+			array = Grow(top, bottom);
+		}
+
+		array->Put(bottom, item);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	std::optional< T > WorkStealingDeque< T >::Pop() noexcept {
+		const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		const auto array  = m_array.load(std::memory_order_relaxed);
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		auto top = m_top.load(std::memory_order_relaxed);
+
+		if (bottom < top) {
+			// The deque is empty.
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return {};
+		}
+
+		const auto item = array->Get(bottom);
+		if (top != bottom) {
+			return item;
+		}
+
+		// The last item: race against the thieves.
+		const bool won = m_top.compare_exchange_strong(top, top + 1,
+													   std::memory_order_seq_cst,
+													   std::memory_order_relaxed);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return won ? std::optional< T >(item) : std::nullopt;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	std::optional< T > WorkStealingDeque< T >::Steal() noexcept {
+		auto top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (bottom <= top) {
+			return {};
+		}
+
+		const auto array = m_array.load(std::memory_order_acquire);
+		const auto item  = array->Get(top);
+		if (!m_top.compare_exchange_strong(top, top + 1,
+										   std::memory_order_seq_cst,
+										   std::memory_order_relaxed)) {
+			return {};
+		}
+
+		return item;
+	}
+
+	template< typename T >
+	typename WorkStealingDeque< T >::Array*
+		WorkStealingDeque< T >::Grow(S64 top, S64 bottom) {
+
+		const auto old_array = m_array.load(std::memory_order_relaxed);
+		auto new_array = MakeUnique< Array >(2u * old_array->GetCapacity());
+		for (auto i = top; i < bottom; ++i) {
+			new_array->Put(i, old_array->Get(i));
+		}
+
+		const auto array = new_array.get();
+		m_arrays.push_back(std::move(new_array));
+		m_array.store(array, std::memory_order_release);
+		return array;
+	}
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <future>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource futures.
+
+	 A resource future refers to a resource which is possibly still loading,
+	 and provides a placeholder resource to use until the resource is ready.
+
+	 @tparam		ResourceT
+					The resource type.
+	 */
+	template< typename ResourceT >
+	class ResourceFuture {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The value type of resource futures.
+		 */
+		using value_type = ResourceT;
+
+		/**
+		 The future type of resource futures.
+		 */
+		using future_type = std::shared_future< SharedPtr< ResourceT > >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an invalid resource future.
+		 */
+		ResourceFuture() noexcept = default;
+
+		/**
+		 Constructs a resource future.
+
+		 @param[in]		future
+						The future of the resource.
+		 @param[in]		placeholder
+						A pointer to the placeholder resource.
+		 */
+		explicit ResourceFuture(future_type future,
+								SharedPtr< ResourceT > placeholder = nullptr) noexcept
+			: m_future(std::move(future)),
+			m_placeholder(std::move(placeholder)) {}
+
+		/**
+		 Constructs a resource future which is ready.
+
+		 @param[in]		resource
+						A pointer to the resource.
+		 */
+		explicit ResourceFuture(SharedPtr< ResourceT > resource)
+			: m_future(),
+			m_placeholder() {
+
+			std::promise< SharedPtr< ResourceT > > promise;
+			promise.set_value(std::move(resource));
+			m_future = promise.get_future().share();
+		}
+
+		/**
+		 Constructs a resource future from the given resource future.
+
+		 @param[in]		future
+						A reference to the resource future to copy.
+		 */
+		ResourceFuture(const ResourceFuture& future) noexcept = default;
+
+		/**
+		 Constructs a resource future by moving the given resource future.
+
+		 @param[in]		future
+						A reference to the resource future to move.
+		 */
+		ResourceFuture(ResourceFuture&& future) noexcept = default;
+
+		/**
+		 Destructs this resource future.
+		 */
+		~ResourceFuture() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource future to this resource future.
+
+		 @param[in]		future
+						A reference to the resource future to copy.
+		 @return		A reference to the copy of the given resource future
+						(i.e. this resource future).
+		 */
+		ResourceFuture& operator=(const ResourceFuture& future) noexcept = default;
+
+		/**
+		 Moves the given resource future to this resource future.
+
+		 @param[in]		future
+						A reference to the resource future to move.
+		 @return		A reference to the moved resource future (i.e. this
+						resource future).
+		 */
+		ResourceFuture& operator=(ResourceFuture&& future) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this resource future refers to a resource.
+
+		 @return		@c true if this resource future refers to a resource.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValid() const noexcept {
+			return m_future.valid();
+		}
+
+		/**
+		 Checks whether the resource of this resource future finished
+		 loading (successfully or not).
+
+		 @pre			This resource future is valid.
+		 @return		@c true if the resource of this resource future
+						finished loading. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsReady() const {
+			return std::future_status::ready
+				== m_future.wait_for(std::chrono::seconds(0));
+		}
+
+		/**
+		 Returns the resource of this resource future if ready, or the
+		 placeholder resource of this resource future otherwise. The
+		 placeholder resource is also returned if the resource failed to load.
+
+		 @return		A pointer to the resource or placeholder resource of
+						this resource future.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > Get() const noexcept {
+			if (!IsValid()) {
+				return m_placeholder;
+			}
+
+			try {
+				return IsReady() ? m_future.get() : m_placeholder;
+			}
+			catch (...) {
+				return m_placeholder;
+			}
+		}
+
+		/**
+		 Returns the placeholder resource of this resource future.
+
+		 @return		A pointer to the placeholder resource of this resource
+						future.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > GetPlaceholder() const noexcept {
+			return m_placeholder;
+		}
+
+		/**
+		 Waits for the resource of this resource future to finish loading.
+
+		 @pre			This resource future is valid.
+		 @return		A pointer to the resource of this resource future.
+		 @throws		Exception
+						Failed to load the resource.
+		 */
+		SharedPtr< ResourceT > Wait() const {
+			return m_future.get();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The future of the resource of this resource future.
+		 */
+		future_type m_future;
+
+		/**
+		 A pointer to the placeholder resource of this resource future.
+		 */
+		SharedPtr< ResourceT > m_placeholder;
+	};
+}
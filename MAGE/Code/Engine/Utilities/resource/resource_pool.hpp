@@ -14,8 +14,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <map>
-#include <mutex>
+#include <array>
+#include <future>
+#include <shared_mutex>
+#include <unordered_map>
 
 #pragma endregion
 
@@ -24,6 +26,233 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// HashedKeyMap
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 A class of hashed key maps.
+
+		 A hashed key map stores its entries by the hash of their key, which
+		 is computed by the caller. Lookups compare full keys only within the
+		 bucket of the given hash, and never copy the key.
+
+		 @tparam		KeyT
+						The key type.
+		 @tparam		ValueT
+						The value type.
+		 */
+		template< typename KeyT, typename ValueT >
+		class HashedKeyMap {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Checks whether this hashed key map is empty.
+
+			 @return		@c true if this hashed key map is empty. @c false
+							otherwise.
+			 */
+			[[nodiscard]]
+			bool empty() const noexcept {
+				return m_entries.empty();
+			}
+
+			/**
+			 Returns the number of entries of this hashed key map.
+
+			 @return		The number of entries of this hashed key map.
+			 */
+			[[nodiscard]]
+			std::size_t size() const noexcept {
+				return m_entries.size();
+			}
+
+			/**
+			 Returns the value corresponding to the given key of this hashed
+			 key map.
+
+			 @param[in]		hash
+							The hash of @a key.
+			 @param[in]		key
+							A reference to the key.
+			 @return		@c nullptr if this hashed key map contains no
+							entry corresponding to the given key.
+			 @return		A pointer to the value corresponding to the given
+							key.
+			 */
+			[[nodiscard]]
+			ValueT* Find(std::size_t hash, const KeyT& key) noexcept;
+
+			/**
+			 Returns the value corresponding to the given key of this hashed
+			 key map.
+
+			 @param[in]		hash
+							The hash of @a key.
+			 @param[in]		key
+							A reference to the key.
+			 @return		@c nullptr if this hashed key map contains no
+							entry corresponding to the given key.
+			 @return		A pointer to the value corresponding to the given
+							key.
+			 */
+			[[nodiscard]]
+			const ValueT* Find(std::size_t hash, const KeyT& key) const noexcept;
+
+			/**
+			 Inserts or assigns the given value to the given key of this
+			 hashed key map.
+
+			 @param[in]		hash
+							The hash of @a key.
+			 @param[in]		key
+							A reference to the key.
+			 @param[in]		value
+							The value.
+			 */
+			void InsertOrAssign(std::size_t hash, const KeyT& key, ValueT value);
+
+			/**
+			 Erases the entry corresponding to the given key of this hashed
+			 key map (if existing).
+
+			 @param[in]		hash
+							The hash of @a key.
+			 @param[in]		key
+							A reference to the key.
+			 */
+			void Erase(std::size_t hash, const KeyT& key) noexcept;
+
+			/**
+			 Erases all entries of this hashed key map.
+			 */
+			void clear() noexcept {
+				m_entries.clear();
+			}
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Class Member Types
+			//-----------------------------------------------------------------
+
+			/**
+			 A struct of identity hashers (i.e. hashers of hashes).
+			 */
+			struct IdentityHash {
+
+			public:
+
+				[[nodiscard]]
+				std::size_t operator()(std::size_t hash) const noexcept {
+					return hash;
+				}
+			};
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The entries of this hashed key map mapped by the hash of their
+			 key.
+			 */
+			std::unordered_multimap< std::size_t, std::pair< KeyT, ValueT >,
+									 IdentityHash > m_entries;
+		};
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// ResourcePoolShard
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 The base-2 logarithm of the number of shards of resource pools.
+		 */
+		constexpr std::size_t g_resource_pool_shard_bits = 4u;
+
+		/**
+		 The number of shards of resource pools.
+		 */
+		constexpr std::size_t g_nb_resource_pool_shards
+			= std::size_t(1u) << g_resource_pool_shard_bits;
+
+		/**
+		 A struct of resource pool shards.
+
+		 @tparam		KeyT
+						The key type.
+		 @tparam		ValueT
+						The value type of the resource map.
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename KeyT, typename ValueT, typename ResourceT >
+		struct ResourcePoolShard {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The resource map of this resource pool shard.
+			 */
+			HashedKeyMap< KeyT, ValueT > m_resource_map;
+
+			/**
+			 The future map (of resources which are being created) of this
+			 resource pool shard.
+			 */
+			HashedKeyMap< KeyT, std::shared_future< SharedPtr< ResourceT > > >
+				m_future_map;
+
+			/**
+			 The reader-writer lock for accessing the resource and future map
+			 of this resource pool shard.
+			 */
+			mutable std::shared_mutex m_mutex;
+		};
+
+		/**
+		 Returns the hash of the given key.
+
+		 @tparam		KeyT
+						The key type.
+		 @param[in]		key
+						A reference to the key.
+		 @return		The hash of @a key.
+		 */
+		template< typename KeyT >
+		[[nodiscard]]
+		std::size_t GetResourceKeyHash(const KeyT& key) noexcept;
+
+		/**
+		 Returns the index of the resource pool shard of the given hash. The
+		 index is derived from the high bits of the (scrambled) hash, since
+		 the low bits select the bucket within the shard.
+
+		 @param[in]		hash
+						The hash of a key.
+		 @return		The index of the resource pool shard of @a hash.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetResourcePoolShardIndex(std::size_t hash) noexcept;
+
+		#pragma endregion
+	}
+
 	//-------------------------------------------------------------------------
 	// ResourcePool
 	//-------------------------------------------------------------------------
@@ -32,6 +261,10 @@ namespace mage {
 	/**
 	 A class of resource pools.
 
+	 A resource pool distributes its resources over a fixed number of shards
+	 by the hash of their key. Each shard has its own reader-writer lock,
+	 which is held exclusively only while adding or removing resources.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -189,6 +422,12 @@ namespace mage {
 		 given key, a new resource is created from the given arguments, added
 		 to this resource pool and returned.
 
+		 The new resource is created without holding a lock of this
+		 resource pool. Concurrent requests for the same key wait for (and
+		 share) the resource which is being created, while requests for other
+		 keys proceed. If the creation fails, the exception is rethrown to all
+		 waiting requests.
+
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
 						The derived resource type.
@@ -228,23 +467,35 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 A resource map used by a resource pool.
+		 A shard used by a resource pool.
 		 */
-		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
+		using Shard = details::ResourcePoolShard< KeyT, WeakPtr< ResourceT >,
+												  ResourceT >;
 
 		//---------------------------------------------------------------------
-		// Member Variables
+		// Member Methods
 		//---------------------------------------------------------------------
 
 		/**
-		 The resource map of this resource pool.
+		 Returns the shard of the given hash of this resource pool.
+
+		 @param[in]		hash
+						The hash of a key.
+		 @return		A reference to the shard of @a hash.
 		 */
-		ResourceMap m_resource_map;
+		[[nodiscard]]
+		Shard& GetShard(std::size_t hash) noexcept {
+			return m_shards[details::GetResourcePoolShardIndex(hash)];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
 
 		/**
-		 The mutex for accessing the resource map of this resource pool.
+		 The shards of this resource pool.
 		 */
-		mutable std::mutex m_mutex;
+		std::array< Shard, details::g_nb_resource_pool_shards > m_shards;
 
 		/**
 		 A class of resources.
@@ -358,6 +609,10 @@ namespace mage {
 	/**
 	 A class of persistent resource pools.
 
+	 A persistent resource pool distributes its resources over a fixed number
+	 of shards by the hash of their key. Each shard has its own reader-writer
+	 lock, which is held exclusively only while adding or removing resources.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -523,6 +778,12 @@ namespace mage {
 		 corresponding to the given key, a new resource is created from the
 		 given arguments, added to this persistent resource pool and returned.
 
+		 The new resource is created without holding a lock of this
+		 persistent resource pool. Concurrent requests for the same key wait
+		 for (and share) the resource which is being created, while requests
+		 for other keys proceed. If the creation fails, the exception is
+		 rethrown to all waiting requests.
+
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
 						The derived resource type.
@@ -562,24 +823,36 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 A resource map used by a persistent resource pool.
+		 A shard used by a persistent resource pool.
 		 */
-		using ResourceMap = std::map< KeyT, SharedPtr< ResourceT > >;
+		using Shard = details::ResourcePoolShard< KeyT, SharedPtr< ResourceT >,
+												  ResourceT >;
 
 		//---------------------------------------------------------------------
-		// Member Variables
+		// Member Methods
 		//---------------------------------------------------------------------
 
 		/**
-		 The resource map of this persistent resource pool.
+		 Returns the shard of the given hash of this persistent resource
+		 pool.
+
+		 @param[in]		hash
+						The hash of a key.
+		 @return		A reference to the shard of @a hash.
 		 */
-		ResourceMap m_resource_map;
+		[[nodiscard]]
+		Shard& GetShard(std::size_t hash) noexcept {
+			return m_shards[details::GetResourcePoolShardIndex(hash)];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
 
 		/**
-		 The mutex for accessing the resource map of this persistent resource
-		 pool.
+		 The shards of this persistent resource pool.
 		 */
-		mutable std::mutex m_mutex;
+		std::array< Shard, details::g_nb_resource_pool_shards > m_shards;
 	};
 
 	#pragma endregion
@@ -1,10 +1,107 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// HashedKeyMap
+		//---------------------------------------------------------------------
+		#pragma region
+
+		template< typename KeyT, typename ValueT >
+		[[nodiscard]]
+		inline ValueT* HashedKeyMap< KeyT, ValueT >
+			::Find(std::size_t hash, const KeyT& key) noexcept {
+
+			auto [first, last] = m_entries.equal_range(hash);
+			for (; first != last; ++first) {
+				if (first->second.first == key) {
+					return &first->second.second;
+				}
+			}
+
+			return nullptr;
+		}
+
+		template< typename KeyT, typename ValueT >
+		[[nodiscard]]
+		inline const ValueT* HashedKeyMap< KeyT, ValueT >
+			::Find(std::size_t hash, const KeyT& key) const noexcept {
+
+			auto [first, last] = m_entries.equal_range(hash);
+			for (; first != last; ++first) {
+				if (first->second.first == key) {
+					return &first->second.second;
+				}
+			}
+
+			return nullptr;
+		}
+
+		template< typename KeyT, typename ValueT >
+		inline void HashedKeyMap< KeyT, ValueT >
+			::InsertOrAssign(std::size_t hash, const KeyT& key, ValueT value) {
+
+			if (auto* const existing = Find(hash, key)) {
+				*existing = std::move(value);
+				return;
+			}
+
+			m_entries.emplace(hash, std::make_pair(key, std::move(value)));
+		}
+
+		template< typename KeyT, typename ValueT >
+		inline void HashedKeyMap< KeyT, ValueT >
+			::Erase(std::size_t hash, const KeyT& key) noexcept {
+
+			auto [first, last] = m_entries.equal_range(hash);
+			for (; first != last; ++first) {
+				if (first->second.first == key) {
+					m_entries.erase(first);
+					return;
+				}
+			}
+		}
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// ResourcePoolShard
+		//---------------------------------------------------------------------
+		#pragma region
+
+		template< typename KeyT >
+		[[nodiscard]]
+		inline std::size_t GetResourceKeyHash(const KeyT& key) noexcept {
+			return std::hash< KeyT >()(key);
+		}
+
+		[[nodiscard]]
+		constexpr std::size_t GetResourcePoolShardIndex(std::size_t hash) noexcept {
+			// Fibonacci hashing
+			const auto scrambled = static_cast< U64 >(hash) * 11400714819323198485ull;
+			return static_cast< std::size_t >(scrambled
+				>> (std::numeric_limits< U64 >::digits - g_resource_pool_shard_bits));
+		}
+
+		#pragma endregion
+	}
+
 	//-------------------------------------------------------------------------
 	// ResourcePool
 	//-------------------------------------------------------------------------
@@ -12,49 +109,42 @@ namespace mage {
 
 	template< typename KeyT, typename ResourceT >
 	ResourcePool< KeyT, ResourceT >::ResourcePool(ResourcePool&& pool) noexcept
-		: m_mutex() {
+		: m_shards() {
 
-		const std::scoped_lock lock(pool.m_mutex);
+		for (std::size_t i = 0u; i < m_shards.size(); ++i) {
+			const std::unique_lock lock(pool.m_shards[i].m_mutex);
 
-		m_resource_map = std::move(pool.m_resource_map);
+			m_shards[i].m_resource_map = std::move(pool.m_shards[i].m_resource_map);
+			m_shards[i].m_future_map   = std::move(pool.m_shards[i].m_future_map);
+		}
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline bool ResourcePool< KeyT, ResourceT >::empty() const noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		using std::empty;
-		return empty(m_resource_map);
+		return std::all_of(m_shards.cbegin(), m_shards.cend(),
+			[](const Shard& shard) noexcept {
+				const std::shared_lock lock(shard.m_mutex);
+				return shard.m_resource_map.empty();
+			});
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline std::size_t ResourcePool< KeyT, ResourceT >::size() const noexcept {
-		const std::scoped_lock lock(m_mutex);
+		std::size_t size = 0u;
+		for (const auto& shard : m_shards) {
+			const std::shared_lock lock(shard.m_mutex);
+			size += shard.m_resource_map.size();
+		}
 
-		using std::size;
-		return size(m_resource_map);
+		return size;
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return true;
-			}
-
-			m_resource_map.erase(it);
-		}
-
-		return false;
+	inline bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
+		return nullptr != Get(key);
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -62,21 +152,14 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
 
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return resource;
-			}
+		// Expired resources are removed by their destructor.
+		const std::shared_lock lock(shard.m_mutex);
 
-			m_resource_map.erase(it);
-		}
-
-		return SharedPtr< ResourceT >();
+		const auto resource = shard.m_resource_map.Find(hash, key);
+		return resource ? resource->lock() : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -93,44 +176,93 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
+
+		{
+			const std::shared_lock lock(shard.m_mutex);
+
+			if (const auto resource = shard.m_resource_map.Find(hash, key)) {
+				if (auto ptr = resource->lock()) {
+					return ptr;
+				}
+			}
+		}
+
+		std::promise< SharedPtr< ResourceT > > promise;
+
+		{
+			std::unique_lock lock(shard.m_mutex);
+
+			if (const auto resource = shard.m_resource_map.Find(hash, key)) {
+				if (auto ptr = resource->lock()) {
+					return ptr;
+				}
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+				// The expired resource may not have reached its destructor
+				// yet.
+				shard.m_resource_map.Erase(hash, key);
+			}
 
-			const auto resource = it->second.lock();
-			if (resource) {
-				return resource;
+			// Wait for the resource which is being created by another
+			// request.
+			if (const auto future = shard.m_future_map.Find(hash, key)) {
+				const auto shared_future = *future;
+				lock.unlock();
+				return shared_future.get();
 			}
 
-			m_resource_map.erase(it);
+			shard.m_future_map.InsertOrAssign(hash, key,
+											  promise.get_future().share());
 		}
 
-		const auto new_resource
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
+		// Create the resource without holding the lock.
+		SharedPtr< ResourceT > new_resource;
+		try {
+			new_resource = MakeAllocatedShared< Resource< DerivedResourceT > >
+				           (*this, key, std::forward< ConstructorArgsT >(args)...);
+		}
+		catch (...) {
+			{
+				const std::unique_lock lock(shard.m_mutex);
+				shard.m_future_map.Erase(hash, key);
+			}
 
-		m_resource_map.emplace(key, new_resource);
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+
+		{
+			const std::unique_lock lock(shard.m_mutex);
+			shard.m_resource_map.InsertOrAssign(hash, key, new_resource);
+			shard.m_future_map.Erase(hash, key);
+		}
+
+		promise.set_value(new_resource);
 
 		return new_resource;
 	}
 
 	template< typename KeyT, typename ResourceT >
 	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
+
+		const std::unique_lock lock(shard.m_mutex);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end() && it->second.expired()) {
+		if (const auto resource = shard.m_resource_map.Find(hash, key);
+			resource && resource->expired()) {
 
-			m_resource_map.erase(it);
+			shard.m_resource_map.Erase(hash, key);
 		}
 	}
 
 	template< typename KeyT, typename ResourceT >
 	inline void ResourcePool< KeyT, ResourceT >::RemoveAll() noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		m_resource_map.clear();
+		for (auto& shard : m_shards) {
+			const std::unique_lock lock(shard.m_mutex);
+			shard.m_resource_map.clear();
+		}
 	}
 
 	#pragma endregion
@@ -175,11 +307,14 @@ namespace mage {
 	template< typename KeyT, typename ResourceT >
 	PersistentResourcePool< KeyT, ResourceT >
 		::PersistentResourcePool(PersistentResourcePool&& pool) noexcept
-		: m_mutex() {
+		: m_shards() {
 
-		const std::scoped_lock lock(pool.m_mutex);
+		for (std::size_t i = 0u; i < m_shards.size(); ++i) {
+			const std::unique_lock lock(pool.m_shards[i].m_mutex);
 
-		m_resource_map = std::move(pool.m_resource_map);
+			m_shards[i].m_resource_map = std::move(pool.m_shards[i].m_resource_map);
+			m_shards[i].m_future_map   = std::move(pool.m_shards[i].m_future_map);
+		}
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -187,10 +322,11 @@ namespace mage {
 	inline bool PersistentResourcePool< KeyT, ResourceT >
 		::empty() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		using std::empty;
-		return empty(m_resource_map);
+		return std::all_of(m_shards.cbegin(), m_shards.cend(),
+			[](const Shard& shard) noexcept {
+				const std::shared_lock lock(shard.m_mutex);
+				return shard.m_resource_map.empty();
+			});
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -198,31 +334,35 @@ namespace mage {
 	inline std::size_t PersistentResourcePool< KeyT, ResourceT >
 		::size() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		std::size_t size = 0u;
+		for (const auto& shard : m_shards) {
+			const std::shared_lock lock(shard.m_mutex);
+			size += shard.m_resource_map.size();
+		}
 
-		using std::size;
-		return size(m_resource_map);
+		return size;
 	}
 
 	template< typename KeyT, typename ResourceT >
-	[[nodiscard]]bool PersistentResourcePool< KeyT, ResourceT >
+	[[nodiscard]]
+	inline bool PersistentResourcePool< KeyT, ResourceT >
 		::Contains(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end());
+		return nullptr != Get(key);
 	}
 
 	template< typename KeyT, typename ResourceT >
-	[[nodiscard]]SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
+
+		const std::shared_lock lock(shard.m_mutex);
 
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end()) ? it->second
-			                                : SharedPtr< ResourceT >();
+		const auto resource = shard.m_resource_map.Find(hash, key);
+		return resource ? *resource : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -239,18 +379,61 @@ namespace mage {
 	SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		{
+			const std::shared_lock lock(shard.m_mutex);
 
-			return it->second;
+			if (const auto resource = shard.m_resource_map.Find(hash, key)) {
+				return *resource;
+			}
 		}
 
-		const auto new_resource = MakeAllocatedShared< DerivedResourceT >
-			                      (std::forward< ConstructorArgsT >(args)...);
+		std::promise< SharedPtr< ResourceT > > promise;
 
-		m_resource_map.emplace(key, new_resource);
+		{
+			std::unique_lock lock(shard.m_mutex);
+
+			if (const auto resource = shard.m_resource_map.Find(hash, key)) {
+				return *resource;
+			}
+
+			// Wait for the resource which is being created by another
+			// request.
+			if (const auto future = shard.m_future_map.Find(hash, key)) {
+				const auto shared_future = *future;
+				lock.unlock();
+				return shared_future.get();
+			}
+
+			shard.m_future_map.InsertOrAssign(hash, key,
+											  promise.get_future().share());
+		}
+
+		// Create the resource without holding the lock.
+		SharedPtr< ResourceT > new_resource;
+		try {
+			new_resource = MakeAllocatedShared< DerivedResourceT >
+				           (std::forward< ConstructorArgsT >(args)...);
+		}
+		catch (...) {
+			{
+				const std::unique_lock lock(shard.m_mutex);
+				shard.m_future_map.Erase(hash, key);
+			}
+
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+
+		{
+			const std::unique_lock lock(shard.m_mutex);
+			shard.m_resource_map.InsertOrAssign(hash, key, new_resource);
+			shard.m_future_map.Erase(hash, key);
+		}
+
+		promise.set_value(new_resource);
 
 		return new_resource;
 	}
@@ -259,23 +442,23 @@ namespace mage {
 	void PersistentResourcePool< KeyT, ResourceT >
 		::Remove(const KeyT& key) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = details::GetResourceKeyHash(key);
+		auto& shard = GetShard(hash);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		const std::unique_lock lock(shard.m_mutex);
 
-			m_resource_map.erase(it);
-		}
+		shard.m_resource_map.Erase(hash, key);
 	}
 
 	template< typename KeyT, typename ResourceT >
 	inline void PersistentResourcePool< KeyT, ResourceT >
 		::RemoveAll() noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		m_resource_map.clear();
+		for (auto& shard : m_shards) {
+			const std::unique_lock lock(shard.m_mutex);
+			shard.m_resource_map.clear();
+		}
 	}
 
 	#pragma endregion
-}
\ No newline at end of file
+}
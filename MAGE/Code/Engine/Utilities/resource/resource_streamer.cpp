@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\resource_streamer.hpp"
+#include "platform\windows.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <objbase.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ResourceStreamer::ResourceStreamer(std::size_t nb_decode_threads)
+		: m_read_queue(),
+		m_decode_queue(),
+		m_mutex(),
+		m_stop(false),
+		m_threads() {
+
+		nb_decode_threads = std::max(nb_decode_threads, std::size_t(1u));
+
+		m_threads.reserve(nb_decode_threads + 1u);
+		m_threads.emplace_back(&ResourceStreamer::Run, this,
+							   std::ref(m_read_queue));
+		for (std::size_t i = 0u; i < nb_decode_threads; ++i) {
+			m_threads.emplace_back(&ResourceStreamer::Run, this,
+								   std::ref(m_decode_queue));
+		}
+	}
+
+	ResourceStreamer::~ResourceStreamer() {
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_stop = true;
+		}
+		m_read_queue.m_condition.notify_all();
+		m_decode_queue.m_condition.notify_all();
+
+		for (auto& thread : m_threads) {
+			thread.join();
+		}
+
+		// Running I/O tasks can schedule decode tasks till they are joined.
+		m_read_queue.m_tasks.clear();
+		m_decode_queue.m_tasks.clear();
+	}
+
+	void ResourceStreamer::Read(TaskFunction task) {
+		Schedule(m_read_queue, std::move(task));
+	}
+
+	void ResourceStreamer::Decode(TaskFunction task) {
+		Schedule(m_decode_queue, std::move(task));
+	}
+
+	void ResourceStreamer::Schedule(TaskQueue& queue, TaskFunction task) {
+		{
+			const std::scoped_lock lock(m_mutex);
+			queue.m_tasks.push_back(std::move(task));
+		}
+		queue.m_condition.notify_one();
+	}
+
+	void ResourceStreamer::Run(TaskQueue& queue) noexcept {
+		// Initializes the COM library for use by the calling thread (e.g.,
+		// for decoding textures with WIC) and sets the thread's concurrency
+		// model to multithreaded concurrency.
+		const auto result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		while (true) {
+			TaskFunction task;
+			{
+				std::unique_lock lock(m_mutex);
+				queue.m_condition.wait(lock, [this, &queue]() noexcept {
+					return m_stop || !queue.m_tasks.empty();
+				});
+
+				if (m_stop) {
+					break;
+				}
+
+				task = std::move(queue.m_tasks.front());
+				queue.m_tasks.pop_front();
+			}
+
+			task();
+		}
+
+		// Uninitialize the COM library.
+		if (SUCCEEDED(result)) {
+			CoUninitialize();
+		}
+	}
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource streamers.
+
+	 A resource streamer owns an I/O thread which reads resource files, and a
+	 number of decode threads which create resources from the data read. The
+	 threads of a resource streamer are separate from the job system, since
+	 loading a resource can take much longer than a frame: threads waiting
+	 for jobs of the job system would otherwise pick up these tasks.
+	 */
+	class ResourceStreamer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of task functions.
+		 */
+		using TaskFunction = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a resource streamer.
+
+		 @param[in]		nb_decode_threads
+						The number of decode threads.
+		 */
+		explicit ResourceStreamer(std::size_t nb_decode_threads = 2u);
+
+		/**
+		 Constructs a resource streamer from the given resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to copy.
+		 */
+		ResourceStreamer(const ResourceStreamer& streamer) = delete;
+
+		/**
+		 Constructs a resource streamer by moving the given resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to move.
+		 */
+		ResourceStreamer(ResourceStreamer&& streamer) = delete;
+
+		/**
+		 Destructs this resource streamer. Running tasks are finished first,
+		 pending tasks are discarded (i.e. destructed without being executed).
+		 */
+		~ResourceStreamer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource streamer to this resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to copy.
+		 @return		A reference to the copy of the given resource streamer
+						(i.e. this resource streamer).
+		 */
+		ResourceStreamer& operator=(const ResourceStreamer& streamer) = delete;
+
+		/**
+		 Moves the given resource streamer to this resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to move.
+		 @return		A reference to the moved resource streamer (i.e. this
+						resource streamer).
+		 */
+		ResourceStreamer& operator=(ResourceStreamer&& streamer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Schedules the given task on the I/O thread of this resource streamer.
+		 Tasks are executed in scheduling order.
+
+		 @pre			@a task does not throw.
+		 @param[in]		task
+						The task.
+		 */
+		void Read(TaskFunction task);
+
+		/**
+		 Schedules the given task on a decode thread of this resource
+		 streamer.
+
+		 @pre			@a task does not throw.
+		 @param[in]		task
+						The task.
+		 */
+		void Decode(TaskFunction task);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of task queues.
+		 */
+		struct TaskQueue {
+
+		public:
+
+			/**
+			 The pending tasks of this task queue.
+			 */
+			std::deque< TaskFunction > m_tasks;
+
+			/**
+			 The condition variable to wake up the threads of this task queue.
+			 */
+			std::condition_variable m_condition;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Schedules the given task on the given task queue.
+
+		 @param[in,out]	queue
+						A reference to the task queue.
+		 @param[in]		task
+						The task.
+		 */
+		void Schedule(TaskQueue& queue, TaskFunction task);
+
+		/**
+		 Runs the loop of a thread of the given task queue.
+
+		 @param[in,out]	queue
+						A reference to the task queue.
+		 */
+		void Run(TaskQueue& queue) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The I/O task queue of this resource streamer.
+		 */
+		TaskQueue m_read_queue;
+
+		/**
+		 The decode task queue of this resource streamer.
+		 */
+		TaskQueue m_decode_queue;
+
+		/**
+		 The mutex protecting the task queues of this resource streamer.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 A flag indicating whether the threads of this resource streamer must
+		 stop.
+		 */
+		bool m_stop;
+
+		/**
+		 A vector containing the threads of this resource streamer.
+		 */
+		std::vector< std::thread > m_threads;
+	};
+}